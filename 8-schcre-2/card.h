@@ -14,6 +14,7 @@
 #define EECE_2560_PROJECTS_CARD_H
 
 #include <array>            // for std::array
+#include <iosfwd>           // for std::ostream
 #include <tuple>            // for std::tie
 
 /**
@@ -11,16 +11,15 @@
  *  [1]: https://en.cppreference.com/w/cpp/algorithm/random_shuffle
  *  [2]: https://en.cppreference.com/w/cpp/container/forward_list
  *  [3]: https://en.cppreference.com/w/cpp/iterator/front_inserter (no longer used)
+ *  [4]: https://doi.org/10.1214/aoap/1177005705 (Bayer & Diaconis, "Trailing the Dovetail Shuffle to its Lair")
  */
 
 #ifndef EECE_2560_PROJECTS_DECK_H
 #define EECE_2560_PROJECTS_DECK_H
 
-// If defined, Deck will use the C++ standard library's std::forward_list as its
-// internal linked list. Otherwise, the custom LinkedList class will be used.
-//#define USE_STANDARD_LIST
-
 #include <algorithm>            // for std::random_shuffle
+#include <cstddef>              // for std::size_t
+#include <iterator>             // for std::next
 #include <optional>             // for std::optional
 #include <ostream>              // for output stream definitions (iosfwd not sufficient)
 #include <random>               // for random number generation
@@ -28,14 +27,13 @@
 
 #include "card.h"
 #include "eece2560_io.h"
-
-#ifdef USE_STANDARD_LIST
-#include <forward_list>         // temporary: for standard list container
-using CardList = std::forward_list<Card>;
-#else
 #include "linked_list.h"
+
+/*
+ * Deck relies on the size and tail tracking of LinkedList, so the former
+ * option to substitute std::forward_list has been removed.
+ */
 using CardList = LinkedList<Card>;
-#endif
 
 /**
  * A deck of playing cards.
@@ -53,17 +51,6 @@ class Deck {
     /// This deck's list of cards
     CardList m_card_list;
 
-    /**
-     * Iterator to the end of the singlely linked card list.
-     *
-     * This iterator is not invalidated by any operation exposed by the Deck
-     * class, so it is safe to store it indefinitely.
-     *
-     * Note: there is a declaration order dependency between m_before_end and
-     * m_card_list.
-     */
-    iterator m_before_end{m_card_list.before_begin()};
-
   public:
 
     /**
@@ -78,6 +65,16 @@ class Deck {
         }
     }
 
+    /**
+     * Creates a Deck containing the cards in the given range, with the first
+     * card of the range on top.
+     *
+     * @tparam Iter Input iterator type.
+     * @param it,end The range of cards to be placed in the deck.
+     */
+    template<typename Iter>
+    Deck(Iter it, Iter end) : m_card_list(it, end) {}
+
     /*
      * We do not need to implement logic to deallocate the linked list in
      * Deck's destructor as recommended in the project instructions since this
@@ -110,11 +107,77 @@ class Deck {
         // Move the new list into this deck's card list. The old card list will
         // be automatically dropped when new_list goes out of scope.
         m_card_list = std::move(new_list);
+    }
+
+    /**
+     * Performs a single riffle shuffle of this deck using a freshly seeded
+     * random number generator.
+     */
+    void riffle()
+    {
+        std::default_random_engine entropy_source(default_random_seed());
+        riffle(entropy_source);
+    }
+
+    /**
+     * Performs a single riffle shuffle of this deck according to the
+     * Gilbert-Shannon-Reeds model [4].
+     *
+     * The deck is cut into a top packet whose size is binomially distributed,
+     * and the two packets are then interleaved by repeatedly dropping the top
+     * card of a packet with probability proportional to that packet's size.
+     * Cards are moved by relinking list nodes; no cards are copied.
+     *
+     * Unlike shuffle, the generator is taken by reference so that repeated
+     * riffles continue the same random sequence.
+     *
+     * Runs in O(N) time.
+     *
+     * @tparam R Random number generator.
+     * @param entropy_source Random number generator.
+     */
+    template<typename R>
+    void riffle(R& entropy_source)
+    {
+        const auto deck_size = m_card_list.size();
+        std::binomial_distribution<std::size_t> cut_distribution(deck_size, 0.5);
+        const auto cut_size = cut_distribution(entropy_source);
+
+        // Split the deck into the top packet and the remainder.
+        CardList top_packet;
+        top_packet.splice_after(
+            top_packet.before_begin(),
+            m_card_list,
+            m_card_list.before_begin(),
+            std::next(m_card_list.begin(), static_cast<std::ptrdiff_t>(cut_size))
+        );
+        CardList bottom_packet = std::move(m_card_list);
 
-        // Set the "before end" iterator to point to the last element of the
-        // new list. This occurs in linear time.
-        m_before_end = m_card_list.before_begin();
-        std::advance(m_before_end, std::distance(m_before_end, end()) - 1);
+        // Interleave the packets back into this deck's (now empty) list.
+        for (auto remaining = deck_size; remaining > 0; --remaining) {
+            std::uniform_int_distribution<std::size_t> drop_distribution(0, remaining - 1);
+            CardList& packet = drop_distribution(entropy_source) < top_packet.size() ? top_packet : bottom_packet;
+            m_card_list.splice_after(m_card_list.before_end(), packet, packet.before_begin());
+        }
+    }
+
+    /**
+     * Cuts this deck by moving the top `count` cards to the bottom of the
+     * deck, preserving their order.
+     *
+     * No cards are copied. This function runs in O(count) time, which is
+     * spent locating the cut point. Cuts of zero cards or of the entire deck
+     * leave the deck unchanged.
+     *
+     * @param count Number of cards to move from the top to the bottom.
+     */
+    void cut(std::size_t count)
+    {
+        if (count == 0 || count >= m_card_list.size()) {
+            return;
+        }
+        const auto cut_point = std::next(m_card_list.begin(), static_cast<std::ptrdiff_t>(count));
+        m_card_list.splice_after(m_card_list.before_end(), m_card_list, m_card_list.before_begin(), cut_point);
     }
 
     /**
@@ -144,11 +207,29 @@ class Deck {
      */
     void place_bottom(Card card)
     {
-        // Insert the given card at the end of the list. Update the "before end"
-        // iterator to the end of the list.
-        m_before_end = m_card_list.insert_after(m_before_end, card);
+        // Insert the given card at the end of the list.
+        m_card_list.push_back(card);
+    }
+
+    /**
+     * Moves all cards from the given pile to the bottom of this deck,
+     * preserving their order and leaving the pile empty.
+     *
+     * No cards are copied. This function runs in O(1) time.
+     *
+     * @param pile Deck whose cards are to be placed at the bottom of this deck.
+     */
+    void place_bottom(Deck& pile)
+    {
+        if (&pile == this) {
+            return;
+        }
+        m_card_list.splice_after(m_card_list.before_end(), pile.m_card_list);
     }
 
+    /// Returns the number of cards in this deck. Runs in O(1) time.
+    [[nodiscard]] std::size_t size() const noexcept { return m_card_list.size(); }
+
     friend std::ostream& operator<<(std::ostream& out, const Deck& deck);
 
     /*
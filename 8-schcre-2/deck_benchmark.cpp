@@ -0,0 +1,515 @@
+/**
+ * Project 2 container benchmarks.
+ *
+ * Compares LinkedList<Card>, Deck (backed by LinkedList<Card>), std::forward_list,
+ * a std::vector-backed deck, and a ring-buffer deck on construction, iteration,
+ * insert/remove churn, shuffling, and dealing. Results are written to the
+ * standard output as CSV with one row per (backend, operation, size).
+ *
+ * Usage: 8-schcre-2-bench [max_size]
+ *
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful timings.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://man7.org/linux/man-pages/man2/getrusage.2.html
+ *  [2] https://man7.org/linux/man-pages/man2/fork.2.html
+ *  [3] https://en.cppreference.com/w/cpp/chrono/steady_clock
+ */
+
+#include <algorithm>        // for std::shuffle
+#include <array>            // for std::array
+#include <chrono>           // for std::chrono::steady_clock
+#include <cstdint>          // for std::uint64_t
+#include <cstdlib>          // for std::strtoull
+#include <forward_list>     // for std::forward_list
+#include <iostream>         // for I/O definitions
+#include <optional>         // for std::optional
+#include <random>           // for std::default_random_engine
+#include <string_view>      // for std::string_view
+#include <type_traits>      // for std::is_same_v
+#include <vector>           // for std::vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EECE2560_BENCH_FORK_CASES
+#include <sys/resource.h>   // for getrusage
+#include <sys/wait.h>       // for waitpid
+#include <unistd.h>         // for fork
+#endif
+
+#include "deck.h"
+#include "linked_list.h"
+
+namespace {
+
+/// Container sizes to benchmark, from a single deck to ten million cards.
+constexpr std::array<std::size_t, 6> k_sizes{52, 1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+
+/// Each measurement is repeated until roughly this many elements have been processed...
+constexpr std::size_t k_min_elements_per_case{2'000'000};
+
+/// ...or until this much time has been measured, whichever comes first.
+constexpr std::uint64_t k_max_ns_per_case{500'000'000};
+
+/// Maximum number of churn operations performed on backends with O(N) middle insertion.
+constexpr std::size_t k_linear_churn_limit{256};
+
+/// Fixed PRNG seed so that every backend shuffles identically.
+constexpr std::default_random_engine::result_type k_seed{2560};
+
+/// Sink for computed values so that the benchmarked work is not optimized away.
+volatile std::uint64_t g_sink{0};
+
+/// Benchmarked operations.
+enum class Operation { Construct, Iterate, Churn, Shuffle, Deal };
+
+constexpr std::array k_operations{
+    Operation::Construct, Operation::Iterate, Operation::Churn, Operation::Shuffle, Operation::Deal
+};
+
+std::string_view operation_name(Operation op)
+{
+    switch (op) {
+        case Operation::Construct: return "construct";
+        case Operation::Iterate: return "iterate";
+        case Operation::Churn: return "insert_remove_churn";
+        case Operation::Shuffle: return "shuffle";
+        case Operation::Deal: return "deal";
+    }
+    __builtin_unreachable();
+}
+
+/// Returns a numeric key for the given card so that iteration does real work.
+std::uint64_t card_key(const Card& card)
+{
+    return static_cast<std::uint64_t>(card.get_rank()) * 4 + static_cast<std::uint64_t>(card.get_suit());
+}
+
+/// Returns `count` cards, cycling through the 52 cards of a sorted deck.
+std::vector<Card> make_cards(std::size_t count)
+{
+    const Deck sorted{};
+    std::vector<Card> cards;
+    cards.reserve(count);
+    while (cards.size() < count) {
+        for (auto it = sorted.begin(); it != sorted.end() && cards.size() < count; ++it) {
+            cards.push_back(*it);
+        }
+    }
+    return cards;
+}
+
+/*
+ * Backends.
+ *
+ * Each backend provides the same static interface:
+ *  - Container build(cards)
+ *  - std::size_t iterate(container)  -> elements visited
+ *  - std::size_t churn(container)    -> insert/remove pairs performed
+ *  - void shuffle(container, rng)
+ *  - std::size_t deal(container)     -> cards dealt
+ *
+ * Backends that cannot perform an operation set the corresponding
+ * k_supports_* flag to false, and no row is emitted for it.
+ */
+
+/// Singly linked list backends: the project 2 LinkedList and std::forward_list.
+template<typename List>
+struct ForwardListBackend {
+    constexpr static std::string_view k_name{
+        std::is_same_v<List, LinkedList<Card>> ? "LinkedList" : "std::forward_list"
+    };
+    constexpr static bool k_supports_churn{true};
+    using Container = List;
+
+    static Container build(const std::vector<Card>& cards) { return Container(std::cbegin(cards), std::cend(cards)); }
+
+    static std::size_t iterate(const Container& list)
+    {
+        std::uint64_t sum{0};
+        std::size_t count{0};
+        for (const auto& card : list) {
+            sum += card_key(card);
+            ++count;
+        }
+        g_sink = g_sink + sum;
+        return count;
+    }
+
+    /// Inserts a card after every element and immediately removes it again.
+    static std::size_t churn(Container& list)
+    {
+        std::size_t count{0};
+        const Card extra(Card::Rank::Ace, Card::Suit::Spade);
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            list.insert_after(it, extra);
+            if constexpr (std::is_same_v<List, LinkedList<Card>>) {
+                list.remove_after(it);
+            } else {
+                list.erase_after(it);
+            }
+            ++count;
+        }
+        return count;
+    }
+
+    /// Copies into a vector, shuffles, and rebuilds, mirroring Deck::shuffle.
+    static void shuffle(Container& list, std::default_random_engine& rng)
+    {
+        std::vector<Card> buffer(std::cbegin(list), std::cend(list));
+        std::shuffle(std::begin(buffer), std::end(buffer), rng);
+        list = Container(std::cbegin(buffer), std::cend(buffer));
+    }
+
+    static std::size_t deal(Container& list)
+    {
+        std::size_t count{0};
+        while (!list.empty()) {
+            g_sink = g_sink + card_key(list.front());
+            list.pop_front();
+            ++count;
+        }
+        return count;
+    }
+};
+
+/// Deck itself, which is backed by LinkedList<Card>.
+struct DeckBackend {
+    constexpr static std::string_view k_name{"Deck"};
+    // Deck does not expose positional insertion.
+    constexpr static bool k_supports_churn{false};
+    using Container = Deck;
+
+    static Container build(const std::vector<Card>& cards) { return Deck(std::cbegin(cards), std::cend(cards)); }
+
+    static std::size_t iterate(const Container& deck)
+    {
+        std::uint64_t sum{0};
+        for (const auto& card : deck) {
+            sum += card_key(card);
+        }
+        g_sink = g_sink + sum;
+        return deck.size();
+    }
+
+    static std::size_t churn(Container&) { return 0; }
+
+    static void shuffle(Container& deck, std::default_random_engine& rng) { deck.shuffle(rng); }
+
+    static std::size_t deal(Container& deck)
+    {
+        std::size_t count{0};
+        while (auto card = deck.deal()) {
+            g_sink = g_sink + card_key(*card);
+            ++count;
+        }
+        return count;
+    }
+};
+
+/// A deck stored in a std::vector with the top card at the back.
+struct VectorBackend {
+    constexpr static std::string_view k_name{"std::vector"};
+    constexpr static bool k_supports_churn{true};
+    using Container = std::vector<Card>;
+
+    static Container build(const std::vector<Card>& cards) { return Container(std::crbegin(cards), std::crend(cards)); }
+
+    static std::size_t iterate(const Container& cards)
+    {
+        std::uint64_t sum{0};
+        for (const auto& card : cards) {
+            sum += card_key(card);
+        }
+        g_sink = g_sink + sum;
+        return cards.size();
+    }
+
+    /// Middle insertion is O(N), so only a bounded number of evenly spaced
+    /// positions are churned.
+    static std::size_t churn(Container& cards)
+    {
+        const Card extra(Card::Rank::Ace, Card::Suit::Spade);
+        const std::size_t count = std::min(cards.size(), k_linear_churn_limit);
+        const std::size_t stride = cards.size() / count;
+        for (std::size_t i{0}; i < count; ++i) {
+            const auto pos = std::begin(cards) + static_cast<std::ptrdiff_t>(i * stride);
+            cards.erase(cards.insert(pos, extra));
+        }
+        return count;
+    }
+
+    static void shuffle(Container& cards, std::default_random_engine& rng)
+    {
+        std::shuffle(std::begin(cards), std::end(cards), rng);
+    }
+
+    static std::size_t deal(Container& cards)
+    {
+        std::size_t count{0};
+        while (!cards.empty()) {
+            g_sink = g_sink + card_key(cards.back());
+            cards.pop_back();
+            ++count;
+        }
+        return count;
+    }
+};
+
+/**
+ * A fixed-capacity ring buffer deck. Dealing advances the head and placing a
+ * card on the bottom writes behind the tail, both in O(1) time with no
+ * allocation.
+ */
+class RingDeck {
+    /// Card slots. Every slot always holds a card since Card has no default constructor.
+    std::vector<Card> m_slots;
+
+    /// Index of the top card.
+    std::size_t m_head{0};
+
+    /// The number of cards currently in the deck.
+    std::size_t m_count;
+
+  public:
+    explicit RingDeck(const std::vector<Card>& cards) : m_slots(cards), m_count{cards.size()} {}
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_count; }
+
+    [[nodiscard]] const Card& operator[](std::size_t index) const { return m_slots[(m_head + index) % m_slots.size()]; }
+
+    std::optional<Card> deal()
+    {
+        if (m_count == 0) {
+            return std::nullopt;
+        }
+        const Card top = m_slots[m_head];
+        m_head = (m_head + 1) % m_slots.size();
+        --m_count;
+        return top;
+    }
+
+    void place_bottom(Card card)
+    {
+        // The bottom slot is free whenever the deck is not full.
+        if (m_count < m_slots.size()) {
+            m_slots[(m_head + m_count) % m_slots.size()] = card;
+            ++m_count;
+        }
+    }
+
+    template<typename R>
+    void shuffle(R& rng)
+    {
+        // Rotate the live cards to the front of the storage so that they
+        // form a contiguous range, then shuffle in place.
+        std::rotate(std::begin(m_slots), std::begin(m_slots) + static_cast<std::ptrdiff_t>(m_head), std::end(m_slots));
+        m_head = 0;
+        std::shuffle(std::begin(m_slots), std::begin(m_slots) + static_cast<std::ptrdiff_t>(m_count), rng);
+    }
+};
+
+struct RingBufferBackend {
+    constexpr static std::string_view k_name{"ring_buffer"};
+    constexpr static bool k_supports_churn{true};
+    using Container = RingDeck;
+
+    static Container build(const std::vector<Card>& cards) { return RingDeck(cards); }
+
+    static std::size_t iterate(const Container& deck)
+    {
+        std::uint64_t sum{0};
+        for (std::size_t i{0}; i < deck.size(); ++i) {
+            sum += card_key(deck[i]);
+        }
+        g_sink = g_sink + sum;
+        return deck.size();
+    }
+
+    /// Ring buffers only support insertion at the ends: deal the top card
+    /// and place it on the bottom.
+    static std::size_t churn(Container& deck)
+    {
+        const std::size_t count = deck.size();
+        for (std::size_t i{0}; i < count; ++i) {
+            deck.place_bottom(*deck.deal());
+        }
+        return count;
+    }
+
+    static void shuffle(Container& deck, std::default_random_engine& rng) { deck.shuffle(rng); }
+
+    static std::size_t deal(Container& deck)
+    {
+        std::size_t count{0};
+        while (auto card = deck.deal()) {
+            g_sink = g_sink + card_key(*card);
+            ++count;
+        }
+        return count;
+    }
+};
+
+/// Result of a single benchmark case.
+struct CaseResult {
+    /// Number of element operations performed across all repetitions.
+    std::uint64_t ops;
+    /// Total measured time in nanoseconds.
+    std::uint64_t total_ns;
+};
+
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t elapsed_ns(Clock::time_point start)
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()
+    );
+}
+
+/**
+ * Runs the given operation on freshly built containers until either
+ * k_min_elements_per_case elements have been processed or k_max_ns_per_case
+ * nanoseconds have been measured. The operation is always run at least once.
+ * Only the operation itself is timed.
+ */
+template<typename Backend>
+CaseResult run_case(Operation op, const std::vector<Card>& cards)
+{
+    const std::size_t repetitions = std::max<std::size_t>(1, k_min_elements_per_case / cards.size());
+    std::default_random_engine rng(k_seed);
+    CaseResult result{0, 0};
+
+    for (std::size_t rep{0}; rep < repetitions && result.total_ns < k_max_ns_per_case; ++rep) {
+        if (op == Operation::Construct) {
+            const auto start = Clock::now();
+            auto container = Backend::build(cards);
+            result.total_ns += elapsed_ns(start);
+            result.ops += cards.size();
+            continue;
+        }
+
+        auto container = Backend::build(cards);
+        const auto start = Clock::now();
+        switch (op) {
+            case Operation::Iterate: {
+                result.ops += Backend::iterate(container);
+                break;
+            }
+            case Operation::Churn: {
+                result.ops += Backend::churn(container);
+                break;
+            }
+            case Operation::Shuffle: {
+                Backend::shuffle(container, rng);
+                result.ops += cards.size();
+                break;
+            }
+            case Operation::Deal: {
+                result.ops += Backend::deal(container);
+                break;
+            }
+            case Operation::Construct:
+                break;
+        }
+        result.total_ns += elapsed_ns(start);
+    }
+    return result;
+}
+
+/// Returns the peak resident set size of the calling process in KiB, if known.
+std::optional<long> peak_rss_kib()
+{
+#ifdef EECE2560_BENCH_FORK_CASES
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        // macOS reports ru_maxrss in bytes rather than KiB [1].
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return std::nullopt;
+}
+
+/// Runs a single case and prints its CSV row.
+template<typename Backend>
+void run_and_report(Operation op, std::size_t size)
+{
+    const auto cards = make_cards(size);
+    const auto result = run_case<Backend>(op, cards);
+
+    std::cout << Backend::k_name << ',' << operation_name(op) << ',' << size << ','
+              << result.ops << ',' << result.total_ns << ',';
+    if (result.ops > 0) {
+        std::cout << static_cast<double>(result.total_ns) / static_cast<double>(result.ops);
+    }
+    std::cout << ',';
+    if (const auto rss = peak_rss_kib()) {
+        std::cout << *rss;
+    }
+    std::cout << '\n';
+}
+
+/**
+ * Runs a case in its own child process where possible, so that the reported
+ * peak RSS reflects only that case [2]. Falls back to running in-process.
+ */
+template<typename Backend>
+void run_isolated(Operation op, std::size_t size)
+{
+#ifdef EECE2560_BENCH_FORK_CASES
+    std::cout.flush();
+    const pid_t pid = fork();
+    if (pid == 0) {
+        run_and_report<Backend>(op, size);
+        std::cout.flush();
+        _exit(0);
+    } else if (pid > 0) {
+        int status{};
+        waitpid(pid, &status, 0);
+        return;
+    }
+    // fork failed; run in-process below.
+#endif
+    run_and_report<Backend>(op, size);
+}
+
+template<typename Backend>
+void run_backend(std::size_t max_size)
+{
+    for (const auto size : k_sizes) {
+        if (size > max_size) {
+            break;
+        }
+        for (const auto op : k_operations) {
+            if (op == Operation::Churn && !Backend::k_supports_churn) {
+                continue;
+            }
+            run_isolated<Backend>(op, size);
+        }
+    }
+}
+
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t max_size{k_sizes.back()};
+    if (argc > 1) {
+        max_size = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+
+    std::cout << "backend,operation,size,ops,total_ns,ns_per_op,peak_rss_kib\n";
+    run_backend<ForwardListBackend<LinkedList<Card>>>(max_size);
+    run_backend<ForwardListBackend<std::forward_list<Card>>>(max_size);
+    run_backend<DeckBackend>(max_size);
+    run_backend<VectorBackend>(max_size);
+    run_backend<RingBufferBackend>(max_size);
+}
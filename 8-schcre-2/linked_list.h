@@ -18,6 +18,8 @@
  *  [8] https://en.cppreference.com/w/cpp/utility/exchange
  *  [9] https://isocpp.github.io/CppCoreGuidelines/CppCoreGuidelines
  *  [10] https://en.cppreference.com/w/cpp/named_req/Container
+ *  [11] https://en.cppreference.com/w/cpp/container/forward_list/splice_after
+ *  [12] https://en.cppreference.com/w/cpp/container/forward_list/merge
  */
 
 #ifndef EECE_2560_PROJECTS_LINKED_LIST_H
@@ -25,6 +27,8 @@
 
 #include "basic_unique.h"
 
+#include <cstddef>          // for std::size_t
+#include <functional>       // for std::less
 #include <iterator>         // for iterator tag
 #include <utility>          // for std::exchange (in move ctor)
 
@@ -32,7 +36,9 @@
  * A singlely linked list.
  *
  * This implementation attempts to expose a similar interface to that of
- * `std::forward_list` from the C++ standard library.
+ * `std::forward_list` from the C++ standard library. Unlike std::forward_list,
+ * this list also tracks its size and its last node, which allows for O(1)
+ * `size`, `push_back`, and whole-list splicing.
  *
  * @tparam T The data type of elements stored in the list.
  */
@@ -71,6 +77,18 @@ class LinkedList {
      */
     BaseNode m_head{};
 
+    /**
+     * Non-owning pointer to the last node in this linked list.
+     *
+     * This pointer will reference m_head when the list is empty.
+     *
+     * Note: there is a declaration order dependency between m_tail and m_head.
+     */
+    BaseNode* m_tail{&m_head};
+
+    /// The number of elements in this linked list.
+    std::size_t m_size{0};
+
   public:
     /**
      * A forward iterator over a linked list.
@@ -177,6 +195,7 @@ class LinkedList {
     using const_iterator = LinkedListIterator<const T>;
     using reference = T&;
     using const_reference = const T&;
+    using size_type = std::size_t;
 
     /*
      * Default constructor.
@@ -229,9 +248,14 @@ class LinkedList {
 
     /*
      * Move constructor [7, C.66 in 9].
+     *
+     * When other is empty, its tail references its own head node, which must
+     * not be taken by this list.
      */
     LinkedList(LinkedList&& other) noexcept
-        : m_head{std::exchange(other.m_head, BaseNode{})} {}
+        : m_head{std::exchange(other.m_head, BaseNode{})},
+          m_tail{other.m_size == 0 ? &m_head : std::exchange(other.m_tail, &other.m_head)},
+          m_size{std::exchange(other.m_size, 0)} {}
 
     // Move assignment [7, C.66 in 9].
     LinkedList& operator=(LinkedList&& other) noexcept
@@ -240,6 +264,12 @@ class LinkedList {
         // lookup if we later define one [C.165 in 9].
         using std::swap;
         swap(m_head, other.m_head);
+        swap(m_tail, other.m_tail);
+        swap(m_size, other.m_size);
+
+        // An empty list's tail must reference its own head node.
+        reset_tail_if_empty();
+        other.reset_tail_if_empty();
         return *this;
     }
 
@@ -273,6 +303,16 @@ class LinkedList {
     [[nodiscard]]
     bool empty() const noexcept { return m_head.m_next_ptr.get() == nullptr; }
 
+    /**
+     * Returns the number of elements in this list.
+     *
+     * Runs in O(1) time.
+     *
+     * @return Number of elements.
+     */
+    [[nodiscard]]
+    size_type size() const noexcept { return m_size; }
+
     /**
     * Inserts the given element into this linked last at the position
     * immediately following the provided iterator.
@@ -298,6 +338,15 @@ class LinkedList {
      */
     void push_front(const T& value) { insert_after(before_begin(), value); }
 
+    /**
+     * Inserts the given element at the back of this list.
+     *
+     * Runs in O(1) time.
+     *
+     * @param value Element to be inserted.
+     */
+    void push_back(const T& value) { insert_after(before_end(), value); }
+
     /**
      * Removes the element immediately following the given position.
      *
@@ -330,6 +379,70 @@ class LinkedList {
      */
     void clear();
 
+    /**
+     * Moves all elements from other into this list, placing them immediately
+     * after the given position. No elements are copied, and other is left
+     * empty.
+     *
+     * This function is named after the analogous function in std::forward_list
+     * [11]. Since both lists track their last nodes and sizes, it runs in O(1)
+     * time.
+     *
+     * The behavior of this function is not defined if other is this list.
+     *
+     * @param position Iterator preceding the insertion position.
+     * @param other List whose elements are to be moved.
+     */
+    void splice_after(iterator position, LinkedList& other);
+
+    /**
+     * Moves the element immediately following `it` in other into this list,
+     * placing it immediately after the given position.
+     *
+     * Other may be this list. Runs in O(1) time.
+     *
+     * @param position Iterator preceding the insertion position.
+     * @param other List containing the element to be moved.
+     * @param it Iterator preceding the element to be moved.
+     */
+    void splice_after(iterator position, LinkedList& other, iterator it);
+
+    /**
+     * Moves the elements in the range (first, last) from other into this
+     * list, placing them immediately after the given position.
+     *
+     * Other may be this list, provided that position is not an iterator in
+     * the range (first, last).
+     *
+     * Runs in O(N) time in the length of the moved range, since the node
+     * preceding `last` must be found and the moved elements must be counted.
+     *
+     * @param position Iterator preceding the insertion position.
+     * @param other List containing the elements to be moved.
+     * @param first,last Exclusive range of elements to be moved.
+     */
+    void splice_after(iterator position, LinkedList& other, iterator first, iterator last);
+
+    /**
+     * Merges two lists sorted in ascending order into this list by relinking
+     * nodes. No elements are copied, and other is left empty.
+     *
+     * This function is named after the analogous function in std::forward_list
+     * [12]. The merge is stable: elements from this list precede equivalent
+     * elements from other.
+     *
+     * Runs in O(N + M) time. If all elements of other compare greater than or
+     * equal to those of this list, the tail of other is spliced in O(1) time
+     * as soon as this list is exhausted.
+     *
+     * @tparam Compare Callable type to compare elements.
+     * @param other Sorted list whose elements are to be merged.
+     * @param comp Binary functor that returns true when its first argument
+     *             compares less than its second.
+     */
+    template<typename Compare = std::less<>>
+    void merge(LinkedList& other, Compare comp = Compare());
+
     /**
      * Returns an iterator that represents an entry just before the beginning
      * of the list.
@@ -360,6 +473,32 @@ class LinkedList {
         return const_iterator{&m_head};
     }
 
+    /**
+     * Returns an iterator to the last element in this list, or the before
+     * begin iterator if this list is empty.
+     *
+     * Inserting after this iterator appends to the list.
+     *
+     * @return Iterator to the last element.
+     */
+    [[nodiscard]]
+    iterator before_end() noexcept
+    {
+        return iterator{m_tail};
+    }
+
+    /**
+     * Returns an iterator to the last element in this list, or the before
+     * begin iterator if this list is empty.
+     *
+     * @return Iterator to the last element.
+     */
+    [[nodiscard]]
+    const_iterator before_end() const noexcept
+    {
+        return const_iterator{m_tail};
+    }
+
     /**
      * Returns an iterator representing the first element in this list.
      *
@@ -403,6 +542,15 @@ class LinkedList {
     {
         return const_iterator{nullptr};
     }
+
+  private:
+    /// Points the tail of this list at its head node if this list is empty.
+    void reset_tail_if_empty() noexcept
+    {
+        if (m_size == 0) {
+            m_tail = &m_head;
+        }
+    }
 }; // end class LinkedList
 
 // Deduction guide for range constructor.
@@ -27,6 +27,12 @@ auto LinkedList<T>::insert_after(iterator position, const T& value) -> iterator
 
     // The local new_node no longer owns any memory.
 
+    if (position.m_iter_pos == m_tail) {
+        // The new node was appended to the end of the list.
+        m_tail = position.m_iter_pos->m_next_ptr.get();
+    }
+    ++m_size;
+
     return position.next();
 }
 
@@ -49,6 +55,12 @@ void LinkedList<T>::remove_after(iterator position)
     // Reference to the pointer held by the current node for convenience.
     BasicUnique<BaseNode>& next_node_ptr = position.m_iter_pos->m_next_ptr;
 
+    if (next_node_ptr.get() == m_tail) {
+        // The last node is being removed.
+        m_tail = position.m_iter_pos;
+    }
+    --m_size;
+
     // Locally scoped pointer for destroying the node that is removed.
     // Default initializes to nullptr.
     BasicUnique<BaseNode> tmp{};
@@ -62,3 +74,129 @@ void LinkedList<T>::remove_after(iterator position)
     swap(tmp, next_node_ptr);
     // The former "next node" will be destructed when tmp goes out of scope.
 }
+
+template<typename T>
+void LinkedList<T>::splice_after(iterator position, LinkedList& other)
+{
+    // Allow a specialized swap to be found through ADL
+    // if we later define one [C.165 in 9 from header].
+    using std::swap;
+
+    if (other.empty()) {
+        return;
+    }
+
+    // The last node of other will be followed by the node currently after
+    // position. The last node of other always owns nullptr, so this swap
+    // leaves position owning nothing.
+    swap(other.m_tail->m_next_ptr, position.m_iter_pos->m_next_ptr);
+    // Give the chain of nodes owned by other's head to position.
+    swap(position.m_iter_pos->m_next_ptr, other.m_head.m_next_ptr);
+
+    if (position.m_iter_pos == m_tail) {
+        m_tail = other.m_tail;
+    }
+    m_size += other.m_size;
+
+    other.m_tail = &other.m_head;
+    other.m_size = 0;
+}
+
+template<typename T>
+void LinkedList<T>::splice_after(iterator position, LinkedList& other, iterator it)
+{
+    using std::swap;
+
+    BaseNode* const node = it.m_iter_pos->m_next_ptr.get();
+
+    // Splicing an element into its own position is a no-op.
+    if (position == it || position.m_iter_pos == node) {
+        return;
+    }
+
+    if (node == other.m_tail) {
+        other.m_tail = it.m_iter_pos;
+    }
+
+    // Take ownership of the moved node. `it` now owns nothing.
+    BasicUnique<BaseNode> tmp{};
+    swap(tmp, it.m_iter_pos->m_next_ptr);
+    // Unlink the moved node: `it` owns the node's successor.
+    swap(it.m_iter_pos->m_next_ptr, tmp->m_next_ptr);
+    // The moved node owns the node after position.
+    swap(tmp->m_next_ptr, position.m_iter_pos->m_next_ptr);
+    // Position owns the moved node.
+    swap(position.m_iter_pos->m_next_ptr, tmp);
+
+    if (position.m_iter_pos == m_tail) {
+        m_tail = node;
+    }
+    --other.m_size;
+    ++m_size;
+}
+
+template<typename T>
+void LinkedList<T>::splice_after(iterator position, LinkedList& other, iterator first, iterator last)
+{
+    using std::swap;
+
+    // Find the last node in the range (first, last) while counting the
+    // number of nodes being moved.
+    BaseNode* before_last = first.m_iter_pos;
+    size_type count{0};
+    while (before_last->m_next_ptr.get() != last.m_iter_pos) {
+        before_last = before_last->m_next_ptr.get();
+        ++count;
+    }
+
+    if (count == 0) {
+        // The range is empty.
+        return;
+    }
+
+    if (before_last == other.m_tail) {
+        other.m_tail = first.m_iter_pos;
+    }
+
+    // Take ownership of the chain (first, last). `first` now owns nothing.
+    BasicUnique<BaseNode> chain{};
+    swap(chain, first.m_iter_pos->m_next_ptr);
+    // `first` owns `last`; the end of the chain now owns nothing.
+    swap(first.m_iter_pos->m_next_ptr, before_last->m_next_ptr);
+    // The end of the chain owns the node after position.
+    swap(before_last->m_next_ptr, position.m_iter_pos->m_next_ptr);
+    // Position owns the chain.
+    swap(position.m_iter_pos->m_next_ptr, chain);
+
+    if (position.m_iter_pos == m_tail) {
+        m_tail = before_last;
+    }
+    other.m_size -= count;
+    m_size += count;
+}
+
+template<typename T>
+template<typename Compare>
+void LinkedList<T>::merge(LinkedList& other, Compare comp)
+{
+    if (&other == this) {
+        return;
+    }
+
+    // Position after which the next smallest element will be placed.
+    auto prev = before_begin();
+
+    while (!other.empty()) {
+        const auto next = prev.next();
+        if (next == end()) {
+            // This list is exhausted. Append the rest of other in O(1) time.
+            splice_after(prev, other);
+            return;
+        }
+        if (comp(other.front(), *next)) {
+            // Move the front node of other in front of `next`.
+            splice_after(prev, other, other.before_begin());
+        }
+        ++prev;
+    }
+}
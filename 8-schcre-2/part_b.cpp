@@ -159,7 +159,7 @@ void display_game_state(const std::vector<FlipCard>& cards, const GameConfig& ga
     std::cout << '\n';
 
     // Print the line of cards.
-    for (const auto card : cards) {
+    for (const auto& card : cards) {
         if (game_config.show_unflipped_cards || card.flipped) {
             std::cout << ' ' << card.card;
         } else {
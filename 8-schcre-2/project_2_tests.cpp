@@ -0,0 +1,213 @@
+/**
+ * Test executable for Project 2.
+ *
+ * Checks that LinkedList keeps its size and last-node tracking consistent
+ * across the splice, merge and push_back operations.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "linked_list.h"
+
+// Using anonymous namespace to give symbols internal linkage.
+namespace {
+
+/// Returns an iterator to the last node of the list found by walking it.
+LinkedList<int>::iterator walk_to_last(LinkedList<int>& list)
+{
+    auto last = list.before_begin();
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        last = it;
+    }
+    return last;
+}
+
+/**
+ * Returns true if the list holds exactly the given values, and its size()
+ * and before_end() agree with a walk of its nodes.
+ */
+bool check_list(LinkedList<int>& list, const std::vector<int>& expected)
+{
+    const std::vector<int> actual(list.begin(), list.end());
+    return actual == expected
+           && list.size() == expected.size()
+           && list.before_end() == walk_to_last(list);
+}
+
+/// Reports the outcome of a single test case and returns whether it passed.
+bool report(const char* name, bool passed)
+{
+    std::cout << "Case " << name << (passed ? " OK\n" : " FAILED\n");
+    return passed;
+}
+
+bool test_push_back()
+{
+    LinkedList<int> list;
+    list.push_back(1);
+    list.push_front(0);
+    list.push_back(2);
+    if (!check_list(list, {0, 1, 2})) {
+        return false;
+    }
+    list.remove_after(list.begin().next());
+    list.push_back(3);
+    return check_list(list, {0, 1, 3});
+}
+
+bool test_splice_empty_list()
+{
+    const std::vector<int> values{1, 2};
+    LinkedList<int> dest(values.begin(), values.end());
+    LinkedList<int> source;
+
+    dest.splice_after(dest.before_end(), source);
+    return check_list(dest, {1, 2}) && check_list(source, {});
+}
+
+bool test_splice_empty_range()
+{
+    const std::vector<int> values{1, 2, 3};
+    LinkedList<int> dest(values.begin(), values.end());
+    LinkedList<int> source(values.begin(), values.end());
+
+    // (first, first.next()) is empty.
+    dest.splice_after(dest.before_end(), source, source.begin(), source.begin().next());
+    return check_list(dest, {1, 2, 3}) && check_list(source, {1, 2, 3});
+}
+
+bool test_splice_whole_list_to_end()
+{
+    const std::vector<int> dest_values{1, 2};
+    const std::vector<int> source_values{3, 4};
+    LinkedList<int> dest(dest_values.begin(), dest_values.end());
+    LinkedList<int> source(source_values.begin(), source_values.end());
+
+    dest.splice_after(dest.before_end(), source);
+    if (!check_list(dest, {1, 2, 3, 4}) || !check_list(source, {})) {
+        return false;
+    }
+    // Both lists must remain usable at their ends.
+    dest.push_back(5);
+    source.push_back(6);
+    return check_list(dest, {1, 2, 3, 4, 5}) && check_list(source, {6});
+}
+
+bool test_splice_single_source_last()
+{
+    const std::vector<int> dest_values{1, 2};
+    const std::vector<int> source_values{3, 4};
+    LinkedList<int> dest(dest_values.begin(), dest_values.end());
+    LinkedList<int> source(source_values.begin(), source_values.end());
+
+    // Move the source's last node to the end of dest. The source tail must move
+    // back and the dest tail must move forward.
+    dest.splice_after(dest.before_end(), source, source.begin());
+    return check_list(dest, {1, 2, 4}) && check_list(source, {3});
+}
+
+bool test_splice_range_source_last()
+{
+    const std::vector<int> dest_values{1, 2};
+    const std::vector<int> source_values{3, 4, 5};
+    LinkedList<int> dest(dest_values.begin(), dest_values.end());
+    LinkedList<int> source(source_values.begin(), source_values.end());
+
+    // Move (3, end) = {4, 5} to the front of dest. The source tail must move
+    // back to 3, and the dest tail must stay on 2.
+    dest.splice_after(dest.before_begin(), source, source.begin(), source.end());
+    return check_list(dest, {4, 5, 1, 2}) && check_list(source, {3});
+}
+
+bool test_splice_range_to_end()
+{
+    const std::vector<int> dest_values{1, 2};
+    const std::vector<int> source_values{3, 4, 5, 6};
+    LinkedList<int> dest(dest_values.begin(), dest_values.end());
+    LinkedList<int> source(source_values.begin(), source_values.end());
+
+    // Move (3, 6) = {4, 5} to the end of dest. Only the dest tail moves.
+    auto last = source.begin().next().next().next();
+    dest.splice_after(dest.before_end(), source, source.begin(), last);
+    return check_list(dest, {1, 2, 4, 5}) && check_list(source, {3, 6});
+}
+
+bool test_splice_range_to_empty()
+{
+    const std::vector<int> source_values{1, 2, 3};
+    LinkedList<int> dest;
+    LinkedList<int> source(source_values.begin(), source_values.end());
+
+    dest.splice_after(dest.before_end(), source, source.before_begin(), source.end());
+    return check_list(dest, {1, 2, 3}) && check_list(source, {});
+}
+
+bool test_merge_empty_other()
+{
+    const std::vector<int> values{1, 3};
+    LinkedList<int> list(values.begin(), values.end());
+    LinkedList<int> other;
+
+    list.merge(other);
+    return check_list(list, {1, 3}) && check_list(other, {});
+}
+
+bool test_merge_into_empty()
+{
+    const std::vector<int> values{1, 3};
+    LinkedList<int> list;
+    LinkedList<int> other(values.begin(), values.end());
+
+    list.merge(other);
+    if (!check_list(list, {1, 3}) || !check_list(other, {})) {
+        return false;
+    }
+    list.push_back(4);
+    return check_list(list, {1, 3, 4});
+}
+
+bool test_merge_interleaved()
+{
+    const std::vector<int> values{1, 4, 6};
+    const std::vector<int> other_values{2, 3, 7, 8};
+    LinkedList<int> list(values.begin(), values.end());
+    LinkedList<int> other(other_values.begin(), other_values.end());
+
+    list.merge(other);
+    return check_list(list, {1, 2, 3, 4, 6, 7, 8}) && check_list(other, {});
+}
+
+bool test_merge_this_last()
+{
+    const std::vector<int> values{5, 9};
+    const std::vector<int> other_values{1, 2};
+    LinkedList<int> list(values.begin(), values.end());
+    LinkedList<int> other(other_values.begin(), other_values.end());
+
+    // The last node of this list remains the last node after the merge.
+    list.merge(other);
+    return check_list(list, {1, 2, 5, 9}) && check_list(other, {});
+}
+
+} // end namespace
+
+int main()
+{
+    bool passed{true};
+    passed &= report("push_back", test_push_back());
+    passed &= report("splice empty list", test_splice_empty_list());
+    passed &= report("splice empty range", test_splice_empty_range());
+    passed &= report("splice whole list to end", test_splice_whole_list_to_end());
+    passed &= report("splice single source-last node", test_splice_single_source_last());
+    passed &= report("splice range ending at source end", test_splice_range_source_last());
+    passed &= report("splice range onto dest end", test_splice_range_to_end());
+    passed &= report("splice range into empty list", test_splice_range_to_empty());
+    passed &= report("merge empty other", test_merge_empty_other());
+    passed &= report("merge into empty list", test_merge_into_empty());
+    passed &= report("merge interleaved", test_merge_interleaved());
+    passed &= report("merge keeps this list's last node", test_merge_this_last());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
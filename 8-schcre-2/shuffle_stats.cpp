@@ -0,0 +1,279 @@
+/**
+ * Project 2 shuffle quality statistics.
+ *
+ * Runs many independent trials of repeated Gilbert-Shannon-Reeds riffle
+ * shuffles (Deck::riffle) and of Deck::shuffle, in parallel, and reports for
+ * each number of riffles the mean number of rising sequences together with the
+ * total variation distance from the uniform distribution.
+ *
+ * Under the GSR model, and under the uniform distribution, the probability of
+ * a permutation depends only on its number of rising sequences [1]. The total
+ * variation distance between the two distributions over permutations is
+ * therefore equal to the distance between their rising sequence count
+ * distributions, which can be estimated from a histogram of counts. The exact
+ * distance predicted by the model is reported alongside the estimate.
+ *
+ * Usage: 8-schcre-2-shuffle-stats [trials] [max_riffles] [deck_size] [threads]
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://doi.org/10.1214/aoap/1177005705 (Bayer & Diaconis, "Trailing the Dovetail Shuffle to its Lair")
+ *  [2] https://en.wikipedia.org/wiki/Eulerian_number
+ *  [3] https://en.cppreference.com/w/cpp/numeric/random/seed_seq
+ */
+
+#include <algorithm>        // for std::min
+#include <cmath>            // for std::abs, std::ldexp
+#include <cstdint>          // for std::uint64_t
+#include <cstdlib>          // for std::strtoull
+#include <iostream>         // for I/O definitions
+#include <random>           // for std::mt19937_64, std::random_device
+#include <thread>           // for std::thread
+#include <vector>           // for std::vector
+
+#include "deck.h"
+
+namespace {
+
+/// Default number of trials for each shuffling method.
+constexpr std::size_t k_default_trials{1'000'000};
+
+/// Default maximum number of consecutive riffles examined.
+constexpr std::size_t k_default_max_riffles{10};
+
+/// Histogram of rising sequence counts. Index r holds the number of trials
+/// that produced a permutation with r rising sequences.
+using Histogram = std::vector<std::uint64_t>;
+
+/// Returns the position of the given card in a sorted deck.
+std::size_t card_ordinal(const Card& card)
+{
+    return static_cast<std::size_t>(card.get_suit()) * Card::ALL_RANKS.size()
+        + static_cast<std::size_t>(card.get_rank());
+}
+
+/**
+ * Returns the number of rising sequences in the given deck, which must
+ * contain distinct cards drawn from the first `deck_size` cards of a sorted deck.
+ *
+ * A rising sequence is a maximal run of consecutive ordinals v, v+1, ... that
+ * appear in increasing positions [1]. There is one rising sequence plus one
+ * more for each v whose successor appears earlier in the deck.
+ *
+ * @param deck Deck to be examined.
+ * @param positions Scratch buffer with at least deck_size entries.
+ */
+std::size_t rising_sequences(const Deck& deck, std::vector<std::size_t>& positions)
+{
+    std::size_t index{0};
+    for (const auto& card : deck) {
+        positions[card_ordinal(card)] = index;
+        ++index;
+    }
+    std::size_t count{1};
+    for (std::size_t value{1}; value < index; ++value) {
+        if (positions[value] < positions[value - 1]) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/**
+ * Returns the distribution of rising sequence counts for uniformly random
+ * permutations of n cards, i.e. the Eulerian numbers A(n, r - 1) / n! [2].
+ *
+ * The recurrence A(n, k) = (k + 1) A(n-1, k) + (n - k) A(n-1, k-1) is divided
+ * through by n at each step so that the values remain probabilities.
+ */
+std::vector<double> uniform_rising_distribution(std::size_t n)
+{
+    // Index k holds the probability of k descents (k + 1 rising sequences).
+    std::vector<double> current{1.0};
+    for (std::size_t m{2}; m <= n; ++m) {
+        std::vector<double> next(m, 0.0);
+        for (std::size_t k{0}; k < m; ++k) {
+            double value{0.0};
+            if (k < current.size()) {
+                value += static_cast<double>(k + 1) * current[k];
+            }
+            if (k > 0) {
+                value += static_cast<double>(m - k) * current[k - 1];
+            }
+            next[k] = value / static_cast<double>(m);
+        }
+        current = std::move(next);
+    }
+
+    // Shift so that index r holds the probability of r rising sequences.
+    std::vector<double> result(n + 1, 0.0);
+    std::copy(std::cbegin(current), std::cend(current), std::begin(result) + 1);
+    return result;
+}
+
+/**
+ * Returns the exact rising sequence distribution after `riffles` GSR riffles
+ * of n cards.
+ *
+ * A permutation with r rising sequences occurs with probability
+ * C(a + n - r, n) / a^n where a = 2^riffles [1]. Relative to the uniform
+ * probability 1/n!, this is the product over j = 1..n of (a - r + j) / a.
+ */
+std::vector<double> riffle_rising_distribution(std::size_t n, std::size_t riffles, const std::vector<double>& uniform)
+{
+    const double a = std::ldexp(1.0, static_cast<int>(riffles));
+    std::vector<double> result(n + 1, 0.0);
+    for (std::size_t r{1}; r <= n; ++r) {
+        double ratio{1.0};
+        for (std::size_t j{1}; j <= n; ++j) {
+            ratio *= (a - static_cast<double>(r) + static_cast<double>(j)) / a;
+        }
+        // Permutations with more than `a` rising sequences are impossible.
+        result[r] = ratio > 0.0 ? uniform[r] * ratio : 0.0;
+    }
+    return result;
+}
+
+/// Returns the total variation distance between two distributions.
+double total_variation(const std::vector<double>& lhs, const std::vector<double>& rhs)
+{
+    double sum{0.0};
+    for (std::size_t i{0}; i < lhs.size(); ++i) {
+        sum += std::abs(lhs[i] - rhs[i]);
+    }
+    return sum / 2;
+}
+
+/// Converts a histogram into an empirical distribution.
+std::vector<double> normalize(const Histogram& histogram, std::uint64_t trials)
+{
+    std::vector<double> result(histogram.size());
+    for (std::size_t i{0}; i < histogram.size(); ++i) {
+        result[i] = static_cast<double>(histogram[i]) / static_cast<double>(trials);
+    }
+    return result;
+}
+
+/// Returns the mean of the values recorded in the given histogram.
+double histogram_mean(const Histogram& histogram, std::uint64_t trials)
+{
+    double sum{0.0};
+    for (std::size_t i{0}; i < histogram.size(); ++i) {
+        sum += static_cast<double>(i) * static_cast<double>(histogram[i]);
+    }
+    return sum / static_cast<double>(trials);
+}
+
+/// Per-thread results: one histogram per riffle count, plus one for Deck::shuffle.
+struct WorkerResult {
+    std::vector<Histogram> riffle_histograms;
+    Histogram shuffle_histogram;
+};
+
+/**
+ * Runs the given number of trials on the calling thread with its own
+ * independently seeded generator.
+ *
+ * Each trial riffles a sorted deck max_riffles times, recording the rising
+ * sequence count after every riffle, and separately shuffles a sorted deck
+ * with Deck::shuffle.
+ */
+WorkerResult run_trials(
+    std::size_t trials,
+    std::size_t max_riffles,
+    const std::vector<Card>& sorted_cards,
+    std::seed_seq::result_type seed)
+{
+    const auto n = sorted_cards.size();
+    WorkerResult result{std::vector<Histogram>(max_riffles + 1, Histogram(n + 1)), Histogram(n + 1)};
+
+    std::mt19937_64 entropy_source(seed);
+    std::vector<std::size_t> positions(Card::ALL_SUITS.size() * Card::ALL_RANKS.size());
+
+    for (std::size_t trial{0}; trial < trials; ++trial) {
+        Deck deck(std::cbegin(sorted_cards), std::cend(sorted_cards));
+        for (std::size_t k{1}; k <= max_riffles; ++k) {
+            deck.riffle(entropy_source);
+            ++result.riffle_histograms[k][rising_sequences(deck, positions)];
+        }
+
+        Deck baseline(std::cbegin(sorted_cards), std::cend(sorted_cards));
+        // Deck::shuffle takes its generator by value, so derive a fresh one.
+        baseline.shuffle(std::mt19937_64(entropy_source()));
+        ++result.shuffle_histogram[rising_sequences(baseline, positions)];
+    }
+    return result;
+}
+
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+    const auto arg_or = [&](int index, std::size_t fallback) {
+        return argc > index ? static_cast<std::size_t>(std::strtoull(argv[index], nullptr, 10)) : fallback;
+    };
+
+    const std::size_t full_deck = Card::ALL_SUITS.size() * Card::ALL_RANKS.size();
+    const std::size_t trials = std::max<std::size_t>(arg_or(1, k_default_trials), 1);
+    const std::size_t max_riffles = arg_or(2, k_default_max_riffles);
+    const std::size_t deck_size = std::min(std::max<std::size_t>(arg_or(3, full_deck), 1), full_deck);
+    const std::size_t thread_count = std::max<std::size_t>(
+        arg_or(4, std::thread::hardware_concurrency()), 1
+    );
+
+    const Deck sorted_deck{};
+    const std::vector<Card> sorted_cards(
+        std::cbegin(sorted_deck),
+        std::next(std::cbegin(sorted_deck), static_cast<std::ptrdiff_t>(deck_size))
+    );
+
+    // Derive independent per-thread seeds from the hardware device [3].
+    std::random_device random_device{};
+    std::seed_seq seed_source{random_device(), random_device(), random_device(), random_device()};
+    std::vector<std::seed_seq::result_type> seeds(thread_count);
+    seed_source.generate(std::begin(seeds), std::end(seeds));
+
+    // Run the trials in parallel. Each worker fills its own result slot.
+    std::vector<WorkerResult> worker_results(thread_count);
+    std::vector<std::thread> workers;
+    for (std::size_t i{0}; i < thread_count; ++i) {
+        const std::size_t share = trials / thread_count + (i < trials % thread_count ? 1 : 0);
+        workers.emplace_back([&, i, share]() {
+            worker_results[i] = run_trials(share, max_riffles, sorted_cards, seeds[i]);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Merge the per-thread histograms.
+    WorkerResult total{std::vector<Histogram>(max_riffles + 1, Histogram(deck_size + 1)), Histogram(deck_size + 1)};
+    for (const auto& partial : worker_results) {
+        for (std::size_t k{1}; k <= max_riffles; ++k) {
+            for (std::size_t r{0}; r <= deck_size; ++r) {
+                total.riffle_histograms[k][r] += partial.riffle_histograms[k][r];
+            }
+        }
+        for (std::size_t r{0}; r <= deck_size; ++r) {
+            total.shuffle_histogram[r] += partial.shuffle_histogram[r];
+        }
+    }
+
+    const auto uniform = uniform_rising_distribution(deck_size);
+
+    std::cout << "method,riffles,deck_size,trials,mean_rising_sequences,tvd_empirical,tvd_model\n";
+    for (std::size_t k{1}; k <= max_riffles; ++k) {
+        const auto& histogram = total.riffle_histograms[k];
+        std::cout << "riffle," << k << ',' << deck_size << ',' << trials << ','
+                  << histogram_mean(histogram, trials) << ','
+                  << total_variation(normalize(histogram, trials), uniform) << ','
+                  << total_variation(riffle_rising_distribution(deck_size, k, uniform), uniform) << '\n';
+    }
+    std::cout << "std::shuffle,," << deck_size << ',' << trials << ','
+              << histogram_mean(total.shuffle_histogram, trials) << ','
+              << total_variation(normalize(total.shuffle_histogram, trials), uniform) << ",0\n";
+}
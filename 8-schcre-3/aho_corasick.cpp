@@ -0,0 +1,44 @@
+/**
+ * Aho-Corasick dictionary automaton definitions for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#include "aho_corasick.h"
+
+AhoCorasickAutomaton::AhoCorasickAutomaton(const Dictionary& dictionary)
+    : m_trie(dictionary),
+      m_failure(m_trie.node_count(), k_start),
+      m_output(m_trie.node_count(), k_no_output),
+      m_depth(m_trie.node_count(), 0)
+{
+    // Trie nodes are numbered in breadth-first order, so the links of every
+    // node at a given depth are known before the nodes one level deeper are
+    // visited. Every node's failure link is shallower than the node itself.
+    for (State node{0}; node < m_trie.node_count(); ++node) {
+        m_trie.for_each_child(node, [&](char label, State child) {
+            m_depth[child] = m_depth[node] + 1;
+            if (node != k_start) {
+                m_failure[child] = next(m_failure[node], label);
+            }
+            const State failure = m_failure[child];
+            m_output[child] = m_trie.is_word(failure) ? failure : m_output[failure];
+        });
+    }
+}
+
+AhoCorasickAutomaton::State AhoCorasickAutomaton::next(State state, char letter) const
+{
+    while (true) {
+        if (const auto child = m_trie.step(state, letter)) {
+            return *child;
+        }
+        if (state == k_start) {
+            return k_start;
+        }
+        state = m_failure[state];
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * Aho-Corasick dictionary automaton declarations for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://doi.org/10.1145/360825.360855 (Aho & Corasick, "Efficient String Matching")
+ *  [2] https://en.wikipedia.org/wiki/Aho%E2%80%93Corasick_algorithm
+ */
+
+#ifndef EECE_2560_PROJECTS_AHO_CORASICK_H
+#define EECE_2560_PROJECTS_AHO_CORASICK_H
+
+#include <cstdint>          // for std::uint32_t
+#include <limits>           // for std::numeric_limits
+#include <string_view>      // for std::string_view
+#include <vector>           // for std::vector
+
+#include "dictionary.h"
+#include "dictionary_trie.h"
+
+/**
+ * A string matching automaton that finds every occurrence of every word of a
+ * dictionary in a text in a single left-to-right pass [1].
+ *
+ * The automaton is a DictionaryTrie augmented with a failure link for each
+ * node, which leads to the node for the longest proper suffix of the node's
+ * prefix that is also a prefix in the trie, and an output link, which leads
+ * to the node for the longest proper suffix that is a whole word [2]. Both
+ * are stored in flat arrays indexed by trie node.
+ */
+class AhoCorasickAutomaton {
+  public:
+    /// Type used to identify states of the automaton.
+    using State = DictionaryTrie::NodeIndex;
+
+    /// The state in which no prefix of any word has been matched.
+    constexpr static State k_start{DictionaryTrie::k_root};
+
+  private:
+    /// Marker for nodes without an output link.
+    constexpr static State k_no_output{std::numeric_limits<State>::max()};
+
+    /// The goto function of the automaton.
+    DictionaryTrie m_trie;
+
+    /// The failure link of each state.
+    std::vector<State> m_failure;
+
+    /// The output link of each state, or k_no_output.
+    std::vector<State> m_output;
+
+    /// The length of the prefix represented by each state.
+    std::vector<std::uint32_t> m_depth;
+
+  public:
+    /// Creates an automaton that matches every word in the given dictionary.
+    explicit AhoCorasickAutomaton(const Dictionary& dictionary);
+
+    /// Returns the state reached by consuming `letter` in the given state.
+    [[nodiscard]] State next(State state, char letter) const;
+
+    /**
+     * Calls `on_match(length)` for each word that ends at the last letter
+     * consumed to reach the given state, from longest to shortest.
+     */
+    template<typename Callback>
+    void for_each_match(State state, Callback on_match) const
+    {
+        if (!m_trie.is_word(state)) {
+            state = m_output[state];
+        }
+        while (state != k_no_output) {
+            on_match(static_cast<std::size_t>(m_depth[state]));
+            state = m_output[state];
+        }
+    }
+
+    /**
+     * Scans the given text, calling `on_match(end, length)` for each word
+     * occurrence, where `end` is the index one past the last letter of the
+     * occurrence.
+     */
+    template<typename Callback>
+    void scan(std::string_view text, Callback on_match) const
+    {
+        State state{k_start};
+        for (std::size_t i{0}; i < text.size(); ++i) {
+            state = next(state, text[i]);
+            for_each_match(state, [&](std::size_t length) { on_match(i + 1, length); });
+        }
+    }
+};
+
+#endif //EECE_2560_PROJECTS_AHO_CORASICK_H
@@ -9,15 +9,33 @@
  * ==========
  *  [1] https://en.cppreference.com/w/cpp/algorithm/iter_swap
  *  [2] https://en.cppreference.com/w/cpp/algorithm/min_element
+ *  [3] https://arxiv.org/abs/1509.05053 (Khuong & Morin, "Array Layouts for Comparison-Based Searching")
+ *  [4] https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
+ *  [5] https://en.wikipedia.org/wiki/Introsort
+ *  [6] https://doi.org/10.1002/spe.4380231105 (Bentley & McIlroy, "Engineering a Sort Function")
+ *  [7] https://en.cppreference.com/w/cpp/thread/async
+ *  [8] https://doi.org/10.1006/jagm.1993.1020 (McIlroy, Bostic & McIlroy, "Engineering Radix Sort")
+ *  [9] https://www.cs.princeton.edu/~rs/strings/paper.pdf
+ *      (Bentley & Sedgewick, "Fast Algorithms for Sorting and Searching Strings")
  */
 
 #ifndef EECE_2560_PROJECTS_ALGO_UTIL_H
 #define EECE_2560_PROJECTS_ALGO_UTIL_H
 
 #include <algorithm>        // std::iter_swap
+#include <array>            // for std::array
+#include <cstddef>          // for std::size_t
 #include <functional>       // for std::less
+#include <future>           // for std::async, std::future
+#include <iterator>         // for std::iterator_traits
 #include <optional>         // for std::optional
+#include <string_view>      // for std::string_view
+#include <thread>           // for std::thread
+#include <type_traits>      // for std::is_base_of_v
 #include <utility>          // for std::swap
+#include <vector>           // for std::vector
+
+#include "heap.h"
 
 namespace eece2560 {
 
@@ -99,8 +117,77 @@ Iter partition_unstable(Iter it, Iter end, Compare comp)
 
     return boundary;
 }
+
+/**
+ * Assigns sorted ranks to the Eytzinger positions of the subtree rooted at
+ * position k by an in-order traversal.
+ */
+inline void eytzinger_fill(std::vector<std::size_t>& ranks, std::size_t k, std::size_t& next_rank)
+{
+    if (k < ranks.size()) {
+        eytzinger_fill(ranks, 2 * k, next_rank);
+        ranks[k] = next_rank;
+        ++next_rank;
+        eytzinger_fill(ranks, 2 * k + 1, next_rank);
+    }
+}
 } // end namespace details
 
+/**
+ * Returns the Eytzinger (breadth-first) layout of a sorted sequence of n
+ * elements [3].
+ *
+ * In this layout, the element at 1-based position k is the parent of those at
+ * positions 2k and 2k + 1 in an implicit complete binary search tree. The
+ * returned vector has n + 1 entries. Entry k for k >= 1 holds the index in
+ * the sorted sequence of the element that belongs at position k; entry 0 is
+ * unused.
+ */
+inline std::vector<std::size_t> eytzinger_ranks(std::size_t n)
+{
+    std::vector<std::size_t> ranks(n + 1, 0);
+    std::size_t next_rank{0};
+    details::eytzinger_fill(ranks, 1, next_rank);
+    return ranks;
+}
+
+/**
+ * Returns the position of the first element that does not compare less than
+ * the needle in a sequence stored in Eytzinger layout.
+ *
+ * The descent through the tree has no data-dependent branches: each level
+ * only computes the next position from the result of a comparison. The
+ * elements a few levels below the current position share a cache line, which
+ * is prefetched ahead of time so that memory latency overlaps the descent [3].
+ *
+ * @tparam T Element type. Should be cheap to compare, e.g. an integer.
+ * @param tree Elements in Eytzinger layout, with the root at position 1.
+ * @param needle Value being searched for.
+ * @return Position of the lower bound in `tree`, or 0 if every element
+ *         compares less than the needle.
+ */
+template<typename T>
+std::size_t eytzinger_lower_bound(const std::vector<T>& tree, const T& needle)
+{
+    // The number of elements that fit in one (typical) cache line.
+    constexpr std::size_t k_line_elements{64 / sizeof(T) > 0 ? 64 / sizeof(T) : 1};
+
+    const std::size_t n = tree.size() - 1;
+    const T* const data = tree.data();
+
+    std::size_t k{1};
+    while (k <= n) {
+        // The descendants of k that are log2(k_line_elements) levels down are
+        // adjacent. Prefetching past the end of the tree is harmless [4].
+        __builtin_prefetch(data + (k * k_line_elements < tree.size() ? k * k_line_elements : 0));
+        k = 2 * k + static_cast<std::size_t>(data[k] < needle);
+    }
+    // The path taken encodes the search result in the bits of k: undo every
+    // right turn taken after the last left turn, and then the left turn itself.
+    const auto trailing_right_turns = static_cast<unsigned>(__builtin_ctzll(~static_cast<unsigned long long>(k)));
+    return k >> (trailing_right_turns + 1);
+}
+
 /**
  * Sorts the given range using a selection sort implementation. This sorting
  * algorithm is stable.
@@ -184,5 +271,389 @@ void quicksort_unstable(Iter it, Iter end, Compare comp = Compare())
     }
 }
 
+namespace details {
+/// Ranges with at most this many elements are finished with insertion sort.
+constexpr std::ptrdiff_t k_insertion_sort_cutoff{16};
+
+/// Ranges with at least this many elements use a ninther rather than a
+/// median of three as their pivot.
+constexpr std::ptrdiff_t k_ninther_cutoff{128};
+
+/// Ranges with fewer than this many elements are not split across threads.
+constexpr std::ptrdiff_t k_parallel_cutoff{1 << 14};
+
+/// Sorts the given range by straight insertion. Efficient for short ranges.
+template<typename Iter, typename Compare>
+void insertion_sort(Iter first, Iter last, Compare comp)
+{
+    if (first == last) {
+        return;
+    }
+    for (Iter it = first + 1; it != last; ++it) {
+        auto value = std::move(*it);
+        Iter hole = it;
+        while (hole != first && comp(value, *(hole - 1))) {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        }
+        *hole = std::move(value);
+    }
+}
+
+/// Returns the iterator to the median of the three given elements.
+template<typename Iter, typename Compare>
+Iter median_of_three(Iter a, Iter b, Iter c, Compare comp)
+{
+    if (comp(*a, *b)) {
+        if (comp(*b, *c)) {
+            return b;
+        }
+        return comp(*a, *c) ? c : a;
+    }
+    if (comp(*a, *c)) {
+        return a;
+    }
+    return comp(*b, *c) ? c : b;
+}
+
+/**
+ * Chooses a pivot for the given range: the median of the first, middle and
+ * last elements, or for large ranges, Tukey's ninther (the median of three
+ * such medians) [6]. Either choice performs well on sorted input.
+ */
+template<typename Iter, typename Compare>
+Iter choose_pivot(Iter first, Iter last, Compare comp)
+{
+    const auto size = last - first;
+    const Iter mid = first + size / 2;
+    const Iter back = last - 1;
+    if (size < k_ninther_cutoff) {
+        return details::median_of_three(first, mid, back, comp);
+    }
+    const auto step = size / 8;
+    return details::median_of_three(
+        details::median_of_three(first, first + step, first + 2 * step, comp),
+        details::median_of_three(mid - step, mid, mid + step, comp),
+        details::median_of_three(back - 2 * step, back - step, back, comp),
+        comp
+    );
+}
+
+/**
+ * Partitions the given range (of at least two elements) around the given
+ * pivot element using Hoare's scheme.
+ *
+ * Scans stop on elements equal to the pivot, so ranges with many duplicates
+ * are still split evenly.
+ *
+ * @return Iterator to the final position of the pivot. Elements before it do
+ *         not compare greater than it, and elements after it do not compare
+ *         less than it.
+ */
+template<typename Iter, typename Compare>
+Iter partition_hoare(Iter first, Iter last, Iter pivot, Compare comp)
+{
+    std::iter_swap(first, pivot);
+    Iter lo = first + 1;
+    Iter hi = last - 1;
+    while (true) {
+        while (lo <= hi && comp(*lo, *first)) {
+            ++lo;
+        }
+        while (lo <= hi && comp(*first, *hi)) {
+            --hi;
+        }
+        if (lo >= hi) {
+            break;
+        }
+        std::iter_swap(lo, hi);
+        ++lo;
+        --hi;
+    }
+    std::iter_swap(first, hi);
+    return hi;
+}
+
+/**
+ * Sorts the given range with introsort, splitting it across up to
+ * `thread_budget` threads.
+ *
+ * @param depth_limit Remaining number of partitioning rounds before the range
+ *                    is handed to heap sort.
+ */
+template<typename Iter, typename Compare>
+void introsort_loop(Iter first, Iter last, Compare comp, int depth_limit, std::size_t thread_budget)
+{
+    while (last - first > k_insertion_sort_cutoff) {
+        if (depth_limit == 0) {
+            // The partitions have been unbalanced for too long. Fall back to
+            // heap sort to guarantee O(n log n) time [5].
+            ::heap_sort_unstable(first, last, comp);
+            return;
+        }
+        --depth_limit;
+
+        const Iter mid = details::partition_hoare(first, last, details::choose_pivot(first, last, comp), comp);
+
+        if (thread_budget > 1 && last - first >= k_parallel_cutoff) {
+            // Fork: sort the left part on a new thread while this thread
+            // sorts the right part, splitting the thread budget between
+            // them. The future propagates any exception thrown by comp [7].
+            const std::size_t left_budget = thread_budget / 2;
+            auto left = std::async(std::launch::async, [=]() {
+                details::introsort_loop(first, mid, comp, depth_limit, left_budget);
+            });
+            details::introsort_loop(mid + 1, last, comp, depth_limit, thread_budget - left_budget);
+            // Join.
+            left.get();
+            return;
+        }
+
+        // Recurse into the smaller part and loop on the larger one, which
+        // bounds the stack depth by O(log n).
+        if (mid - first < last - mid) {
+            details::introsort_loop(first, mid, comp, depth_limit, 1);
+            first = mid + 1;
+        } else {
+            details::introsort_loop(mid + 1, last, comp, depth_limit, 1);
+            last = mid;
+        }
+    }
+    details::insertion_sort(first, last, comp);
+}
+
+/// Returns the introsort depth limit for a range of the given size, 2 log2(n).
+inline int introsort_depth_limit(std::ptrdiff_t size)
+{
+    int depth{0};
+    while (size > 1) {
+        size /= 2;
+        depth += 2;
+    }
+    return depth;
+}
+} // end namespace details
+
+/**
+ * Sorts the given range using introsort [5]: quicksort with median-of-three or
+ * ninther pivots, finished by insertion sort on short ranges, that switches to
+ * heap sort if partitioning goes badly. This sort is unstable.
+ *
+ * Runs in O(n log n) time, including on sorted input, and O(log n) space.
+ *
+ * @tparam Iter Random access iterator type.
+ * @tparam Compare Callable type to compare elements.
+ * @param first,last Range to be sorted.
+ * @param comp Binary functor that returns true when its first argument
+ *             compares less than its second.
+ */
+template<typename Iter, typename Compare = std::less<>>
+void introsort(Iter first, Iter last, Compare comp = Compare())
+{
+    using category = typename std::iterator_traits<Iter>::iterator_category;
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category>);
+
+    details::introsort_loop(first, last, comp, details::introsort_depth_limit(last - first), 1);
+}
+
+/**
+ * Sorts the given range with a fork-join parallel introsort.
+ *
+ * Each partitioning step on a large enough range hands one of its two parts
+ * to a new thread, until `thread_count` threads are busy. Afterwards, each
+ * thread continues with the sequential introsort. This sort is unstable.
+ *
+ * The comparison function object is copied to each thread, and is invoked
+ * concurrently, so it must be safe to call from multiple threads.
+ *
+ * @tparam Iter Random access iterator type.
+ * @tparam Compare Callable type to compare elements.
+ * @param first,last Range to be sorted.
+ * @param comp Binary functor that returns true when its first argument
+ *             compares less than its second.
+ * @param thread_count Maximum number of threads to use, which defaults to
+ *                     the number of hardware threads.
+ */
+template<typename Iter, typename Compare = std::less<>>
+void parallel_sort(
+    Iter first,
+    Iter last,
+    Compare comp = Compare(),
+    std::size_t thread_count = std::thread::hardware_concurrency())
+{
+    using category = typename std::iterator_traits<Iter>::iterator_category;
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category>);
+
+    details::introsort_loop(
+        first, last, comp, details::introsort_depth_limit(last - first), std::max<std::size_t>(thread_count, 1)
+    );
+}
+
+namespace details {
+/// Buckets with at most this many strings are sorted with multikey quicksort.
+constexpr std::ptrdiff_t k_radix_cutoff{64};
+
+/// The number of radix sort buckets: one per byte value, plus one for strings
+/// that have ended.
+constexpr std::size_t k_radix_buckets{257};
+
+/**
+ * Returns the radix sort key of the character at the given position of a
+ * string: 0 past the end of the string, and 1 + the character value otherwise,
+ * so that shorter strings sort first.
+ */
+inline std::size_t radix_key(std::string_view str, std::size_t depth)
+{
+    return depth < str.size() ? std::size_t{1} + static_cast<unsigned char>(str[depth]) : 0;
+}
+
+/**
+ * Sorts the given range of strings, which all share their first `depth`
+ * characters, with multikey quicksort [9]: a three-way partition on the
+ * character at `depth`, after which the equal part only needs to be sorted
+ * on its remaining characters.
+ */
+template<typename Iter>
+void multikey_quicksort(Iter first, Iter last, std::size_t depth)
+{
+    while (last - first > k_insertion_sort_cutoff) {
+        const auto key_at = [depth](Iter it) { return details::radix_key(*it, depth); };
+
+        // Median of three pivot character.
+        const Iter mid = first + (last - first) / 2;
+        const Iter pivot_it = details::median_of_three(first, mid, last - 1, [depth](const auto& lhs, const auto& rhs) {
+            return details::radix_key(lhs, depth) < details::radix_key(rhs, depth);
+        });
+        const auto pivot = key_at(pivot_it);
+
+        // Dijkstra's three-way partition: [first, lt) < pivot, [lt, gt) ==
+        // pivot, [gt, last) > pivot.
+        Iter lt = first;
+        Iter gt = last;
+        Iter it = first;
+        while (it < gt) {
+            const auto key = key_at(it);
+            if (key < pivot) {
+                std::iter_swap(lt, it);
+                ++lt;
+                ++it;
+            } else if (pivot < key) {
+                --gt;
+                std::iter_swap(it, gt);
+            } else {
+                ++it;
+            }
+        }
+
+        details::multikey_quicksort(first, lt, depth);
+        details::multikey_quicksort(gt, last, depth);
+        if (pivot == 0) {
+            // The equal part holds identical strings that have all ended.
+            return;
+        }
+        // Continue with the equal part on the next character. Iterating
+        // rather than recursing keeps long common prefixes off the stack.
+        first = lt;
+        last = gt;
+        ++depth;
+    }
+
+    // Compare only the characters after the shared prefix.
+    details::insertion_sort(first, last, [depth](const auto& lhs, const auto& rhs) {
+        return std::string_view(lhs).substr(depth) < std::string_view(rhs).substr(depth);
+    });
+}
+
+/**
+ * Sorts the given range of strings, which all share their first `depth`
+ * characters, with an in-place most significant digit radix sort (American
+ * flag sort) [8].
+ */
+template<typename Iter>
+void msd_radix_sort(Iter first, Iter last, std::size_t depth)
+{
+    while (last - first > k_radix_cutoff) {
+        // Count the strings that belong in each bucket.
+        std::array<std::size_t, k_radix_buckets> bucket_end{};
+        for (Iter it = first; it != last; ++it) {
+            ++bucket_end[details::radix_key(*it, depth)];
+        }
+
+        // If every string falls in the same bucket, move on to the next
+        // character without permuting or recursing.
+        const auto range_size = static_cast<std::size_t>(last - first);
+        const auto largest = *std::max_element(std::begin(bucket_end), std::end(bucket_end));
+        if (largest == range_size) {
+            if (bucket_end[0] == range_size) {
+                // Every string has ended, so they are all equal.
+                return;
+            }
+            ++depth;
+            continue;
+        }
+
+        // Convert the counts into bucket boundaries.
+        std::array<std::size_t, k_radix_buckets> bucket_next{};
+        std::size_t offset{0};
+        for (std::size_t bucket{0}; bucket < k_radix_buckets; ++bucket) {
+            bucket_next[bucket] = offset;
+            offset += bucket_end[bucket];
+            bucket_end[bucket] = offset;
+        }
+
+        // Permute the strings into their buckets in place. Each swap places
+        // at least one string in its final bucket.
+        for (std::size_t bucket{0}; bucket < k_radix_buckets; ++bucket) {
+            while (bucket_next[bucket] < bucket_end[bucket]) {
+                const Iter current = first + static_cast<std::ptrdiff_t>(bucket_next[bucket]);
+                const auto key = details::radix_key(*current, depth);
+                if (key == bucket) {
+                    ++bucket_next[bucket];
+                } else {
+                    std::iter_swap(current, first + static_cast<std::ptrdiff_t>(bucket_next[key]));
+                    ++bucket_next[key];
+                }
+            }
+        }
+
+        // Sort each bucket on the next character. Bucket 0 holds strings
+        // that have ended, which are all equal.
+        std::size_t bucket_begin{bucket_end[0]};
+        for (std::size_t bucket{1}; bucket < k_radix_buckets; ++bucket) {
+            details::msd_radix_sort(
+                first + static_cast<std::ptrdiff_t>(bucket_begin),
+                first + static_cast<std::ptrdiff_t>(bucket_end[bucket]),
+                depth + 1
+            );
+            bucket_begin = bucket_end[bucket];
+        }
+        return;
+    }
+    details::multikey_quicksort(first, last, depth);
+}
+} // end namespace details
+
+/**
+ * Sorts the given range of strings in lexicographic order using a most
+ * significant digit radix sort [8], which switches to multikey quicksort [9]
+ * for small buckets.
+ *
+ * Unlike comparison sorts, which compare the common prefixes of strings over
+ * and over, this sort examines each character of each string about once. The
+ * sort is unstable.
+ *
+ * @tparam Iter Random access iterator type whose elements are convertible to
+ *              std::string_view.
+ * @param first,last Range to be sorted.
+ */
+template<typename Iter>
+void string_radix_sort(Iter first, Iter last)
+{
+    using category = typename std::iterator_traits<Iter>::iterator_category;
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category>);
+
+    details::msd_radix_sort(first, last, 0);
+}
+
 } // end namespace eece2560
 #endif //EECE_2560_PROJECTS_ALGO_UTIL_H
@@ -8,6 +8,7 @@
  * References
  * ==========
  *  [1] https://en.cppreference.com/w/cpp/iterator/istream_iterator
+ *  [2] https://arxiv.org/abs/1509.05053 (Khuong & Morin, "Array Layouts for Comparison-Based Searching")
  *
  */
 
@@ -19,9 +20,27 @@
 #include <iterator>         // for std::istream_iterator
 
 #include "algo_util.h"
-#include "heap.h"
 #include "eece2560_io.h"
 
+namespace {
+/**
+ * Packs the first eight letters of the given word into an integer, most
+ * significant byte first and padded with zeros, so that comparing the
+ * integers of two words compares their first eight letters lexicographically.
+ */
+std::uint64_t prefix_key(std::string_view word)
+{
+    std::uint64_t key{0};
+    for (std::size_t i{0}; i < 8; ++i) {
+        key <<= 8;
+        if (i < word.size()) {
+            key |= static_cast<unsigned char>(word[i]);
+        }
+    }
+    return key;
+}
+} // end namespace
+
 Dictionary Dictionary::read_file(const char* file_name, SortingAlgorithm algorithm)
 {
     std::ifstream in_stream(file_name);
@@ -40,21 +59,7 @@ Dictionary Dictionary::read_file(const char* file_name, SortingAlgorithm algorit
 
 void Dictionary::sort_words(Dictionary::SortingAlgorithm algorithm)
 {
-    switch (algorithm) {
-        case SortingAlgorithm::SelectionSort: {
-            eece2560::selection_sort(std::begin(m_words), std::end(m_words));
-            break;
-        }
-        case SortingAlgorithm::QuickSort: {
-            eece2560::quicksort_unstable(std::begin(m_words), std::end(m_words));
-            break;
-        }
-        case SortingAlgorithm::HeapSort: {
-            heap_sort_unstable(std::begin(m_words), std::end(m_words));
-            break;
-        }
-    }
-
+    sort_range(algorithm, std::begin(m_words), std::end(m_words));
 }
 
 std::ostream& operator<<(std::ostream& out, const Dictionary& dictionary)
@@ -74,6 +79,42 @@ void Dictionary::normalize_word()
 
 bool Dictionary::contains(const std::string_view key) const
 {
-    const auto result = eece2560::binary_search(std::begin(m_words), std::end(m_words), key);
-    return static_cast<bool>(result);
+    if (m_search_keys.empty()) {
+        const auto result = eece2560::binary_search(std::begin(m_words), std::end(m_words), key);
+        return static_cast<bool>(result);
+    }
+
+    // Find the first word whose first eight letters are not less than those
+    // of the key [2].
+    const auto position = eece2560::eytzinger_lower_bound(m_search_keys, prefix_key(key));
+    if (position == 0) {
+        return false;
+    }
+
+    // Words sharing their first eight letters with the key follow in sorted
+    // order. These are few, so they are checked in turn.
+    for (std::size_t index{m_search_ranks[position]}; index < m_words.size(); ++index) {
+        const std::string_view word = m_words[index];
+        if (word >= key) {
+            return word == key;
+        }
+    }
+    return false;
+}
+
+void Dictionary::build_search_index()
+{
+    m_search_keys.clear();
+    m_search_ranks.clear();
+    if (m_words.size() < k_eytzinger_threshold) {
+        return;
+    }
+
+    const auto ranks = eece2560::eytzinger_ranks(m_words.size());
+    m_search_keys.resize(ranks.size(), 0);
+    m_search_ranks.resize(ranks.size(), 0);
+    for (std::size_t position{1}; position < ranks.size(); ++position) {
+        m_search_keys[position] = prefix_key(m_words[ranks[position]]);
+        m_search_ranks[position] = static_cast<std::uint32_t>(ranks[position]);
+    }
 }
@@ -10,10 +10,14 @@
 #ifndef EECE_2560_PROJECTS_DICTIONARY_H
 #define EECE_2560_PROJECTS_DICTIONARY_H
 
+#include <cstdint>          // for std::uint32_t, std::uint64_t
 #include <iostream>         // for I/O stream definitions
 #include <string>           // for std::string
 #include <vector>           // for std::vector
 
+#include "algo_util.h"
+#include "heap.h"
+
 /**
  * A collection words.
  */
@@ -22,9 +26,23 @@ class Dictionary {
     /// The words in this dictionary.
     std::vector<std::string> m_words;
 
+    /**
+     * The first eight letters of each word, packed into integers that
+     * compare in the same order as the letters, in Eytzinger layout.
+     *
+     * Only built for large dictionaries. Position 0 is unused.
+     */
+    std::vector<std::uint64_t> m_search_keys;
+
+    /// The index in m_words of the word at each position of m_search_keys.
+    std::vector<std::uint32_t> m_search_ranks;
+
+    /// The number of words at which contains() switches to the Eytzinger index.
+    constexpr static std::size_t k_eytzinger_threshold{1024};
+
   public:
     /// The sorting algorithms that may be used to sort the dictionary.
-    enum class SortingAlgorithm { SelectionSort, QuickSort, HeapSort };
+    enum class SortingAlgorithm { SelectionSort, QuickSort, HeapSort, ParallelSort, RadixSort };
 
     /// Creates a dictionary with no words.
     Dictionary() = default;
@@ -35,6 +53,7 @@ class Dictionary {
     {
         normalize_word();
         sort_words(algorithm);
+        build_search_index();
     }
 
     /**
@@ -44,9 +63,31 @@ class Dictionary {
      */
     static Dictionary read_file(const char* file_name, SortingAlgorithm algorithm = SortingAlgorithm::HeapSort);
 
-    /// Returns true if the given word is contained in this dictionary.
+    /**
+     * Returns true if the given word is contained in this dictionary.
+     *
+     * Large dictionaries are searched through an Eytzinger index of word
+     * prefixes, and small ones with a plain binary search.
+     */
     [[nodiscard]] bool contains(std::string_view key) const;
 
+    /// Returns the normalized words in this dictionary in sorted order.
+    [[nodiscard]] const std::vector<std::string>& words() const { return m_words; }
+
+    /**
+     * Sorts the given range in ascending order with the given algorithm.
+     *
+     * This is the dispatch used to sort the words of every dictionary. It is
+     * exposed so that other tools, such as the sorting benchmark, run exactly
+     * the same code as Dictionary.
+     *
+     * @tparam Iter Random access iterator type.
+     * @param algorithm The sorting algorithm to use.
+     * @param first,last The range of elements to be sorted.
+     */
+    template<typename Iter>
+    static void sort_range(SortingAlgorithm algorithm, Iter first, Iter last);
+
     friend std::ostream& operator<<(std::ostream& os, const Dictionary& dictionary);
 
   private:
@@ -55,13 +96,43 @@ class Dictionary {
 
     /// Normalizes the words in this dictionary to lowercase strings.
     void normalize_word();
+
+    /// Builds the Eytzinger search index if this dictionary is large enough.
+    void build_search_index();
 };
 
+template<typename Iter>
+void Dictionary::sort_range(SortingAlgorithm algorithm, Iter first, Iter last)
+{
+    switch (algorithm) {
+        case SortingAlgorithm::SelectionSort: {
+            eece2560::selection_sort(first, last);
+            break;
+        }
+        case SortingAlgorithm::QuickSort: {
+            eece2560::quicksort_unstable(first, last);
+            break;
+        }
+        case SortingAlgorithm::HeapSort: {
+            heap_sort_bottom_up(first, last);
+            break;
+        }
+        case SortingAlgorithm::ParallelSort: {
+            eece2560::parallel_sort(first, last);
+            break;
+        }
+        case SortingAlgorithm::RadixSort: {
+            eece2560::string_radix_sort(first, last);
+            break;
+        }
+    }
+}
+
 inline std::istream& operator>>(std::istream& in, Dictionary::SortingAlgorithm& algorithm)
 {
     using underlying_type = std::underlying_type_t<Dictionary::SortingAlgorithm>;
     constexpr auto first = static_cast<underlying_type>(Dictionary::SortingAlgorithm::SelectionSort);
-    constexpr auto last = static_cast<underlying_type>(Dictionary::SortingAlgorithm::HeapSort);
+    constexpr auto last = static_cast<underlying_type>(Dictionary::SortingAlgorithm::RadixSort);
 
     underlying_type temp;
     in >> temp;
@@ -93,6 +164,14 @@ inline std::ostream& operator<<(std::ostream& out, Dictionary::SortingAlgorithm&
             out << "HeapSort";
             break;
         }
+        case SortingAlgorithm::ParallelSort: {
+            out << "ParallelSort";
+            break;
+        }
+        case SortingAlgorithm::RadixSort: {
+            out << "RadixSort";
+            break;
+        }
 
     }
     return out;
@@ -0,0 +1,55 @@
+/**
+ * Offline dictionary compiler for project 3.
+ *
+ * Reads a plain text dictionary, normalizes and sorts it once, and writes the
+ * result as a compiled dictionary and a prebuilt hash dictionary that the word
+ * search can load without repeating that work on every launch.
+ *
+ * Usage: 8-schcre-3-dict-compiler [input] [hash_output] [compiled_output]
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#include <exception>            // for std::exception
+#include <iostream>             // for I/O stream definitions
+
+#include "dictionary.h"
+#include "hash_dictionary.h"
+#include "mapped_dictionary.h"
+
+/// Default plain text dictionary to be compiled.
+constexpr const char* DEFAULT_INPUT_FILE = "resources/dictionary.txt";
+
+/// Default location of the compiled hash dictionary.
+constexpr const char* DEFAULT_HASH_FILE = "resources/dictionary.hash";
+
+/// Default location of the compiled dictionary.
+constexpr const char* DEFAULT_COMPILED_FILE = "resources/dictionary.bin";
+
+int main(int argc, char* argv[])
+{
+    const char* input_file = argc > 1 ? argv[1] : DEFAULT_INPUT_FILE;
+    const char* hash_file = argc > 2 ? argv[2] : DEFAULT_HASH_FILE;
+    const char* compiled_file = argc > 3 ? argv[3] : DEFAULT_COMPILED_FILE;
+
+    try {
+        const auto dictionary = Dictionary::read_file(input_file);
+        if (dictionary.words().empty()) {
+            std::cerr << "error: no words could be read from " << input_file << '\n';
+            return 1;
+        }
+
+        const HashDictionary hash_dictionary(dictionary);
+        hash_dictionary.save_file(hash_file);
+        std::cout << "Wrote " << hash_dictionary.size() << " words to " << hash_file << '\n';
+
+        MappedDictionary::write_file(dictionary, compiled_file);
+        std::cout << "Wrote " << hash_dictionary.size() << " words to " << compiled_file << '\n';
+    } catch (const std::exception& error) {
+        std::cerr << "error: " << error.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,93 @@
+/**
+ * Trie dictionary index definitions for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#include "dictionary_trie.h"
+
+#include <algorithm>        // for std::find
+
+DictionaryTrie::DictionaryTrie(const Dictionary& dictionary)
+{
+    build(dictionary.words());
+}
+
+DictionaryTrie::DictionaryTrie(const MappedDictionary& dictionary)
+{
+    build(dictionary);
+}
+
+template<typename Words>
+void DictionaryTrie::build(const Words& words)
+{
+    // The words sharing the prefix of a node form a contiguous range of the
+    // sorted dictionary, and the words equal to that prefix sort first. Each
+    // child of a node in turn owns a contiguous sub-range, so the trie can be
+    // built breadth-first directly from the sorted words.
+    struct PendingNode {
+        std::size_t first;
+        std::size_t last;
+        std::size_t depth;
+    };
+    std::vector<PendingNode> nodes{{0, words.size(), 0}};
+
+    for (std::size_t node{0}; node < nodes.size(); ++node) {
+        // Copy, since appending children may reallocate `nodes`.
+        auto [first, last, depth] = nodes[node];
+        m_edge_begin.push_back(static_cast<std::uint32_t>(m_edge_labels.size()));
+
+        bool terminal{false};
+        while (first < last && words[first].size() == depth) {
+            terminal = true;
+            ++first;
+        }
+        m_terminal.push_back(terminal);
+
+        while (first < last) {
+            const char label = words[first][depth];
+            auto child_last = first;
+            while (child_last < last && words[child_last][depth] == label) {
+                ++child_last;
+            }
+            m_edge_labels.push_back(label);
+            m_edge_targets.push_back(static_cast<NodeIndex>(nodes.size()));
+            nodes.push_back({first, child_last, depth + 1});
+            first = child_last;
+        }
+    }
+    m_edge_begin.push_back(static_cast<std::uint32_t>(m_edge_labels.size()));
+}
+
+std::optional<DictionaryTrie::NodeIndex> DictionaryTrie::step(NodeIndex node, char letter) const
+{
+    const auto labels_begin = std::begin(m_edge_labels) + m_edge_begin[node];
+    const auto labels_end = std::begin(m_edge_labels) + m_edge_begin[node + 1];
+
+    const auto edge = std::find(labels_begin, labels_end, letter);
+    if (edge == labels_end) {
+        return std::nullopt;
+    }
+    return m_edge_targets[static_cast<std::size_t>(edge - std::begin(m_edge_labels))];
+}
+
+std::optional<DictionaryTrie::NodeIndex> DictionaryTrie::find_prefix(std::string_view prefix, NodeIndex node) const
+{
+    for (const char letter : prefix) {
+        const auto next = step(node, letter);
+        if (!next) {
+            return std::nullopt;
+        }
+        node = *next;
+    }
+    return node;
+}
+
+bool DictionaryTrie::contains(std::string_view key) const
+{
+    const auto node = find_prefix(key);
+    return node && is_word(*node);
+}
@@ -0,0 +1,116 @@
+/**
+ * Trie dictionary index declarations for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://en.wikipedia.org/wiki/Trie
+ *  [2] https://en.wikipedia.org/wiki/Sparse_matrix#Compressed_sparse_row_(CSR,_CRS_or_Yale_format)
+ */
+
+#ifndef EECE_2560_PROJECTS_DICTIONARY_TRIE_H
+#define EECE_2560_PROJECTS_DICTIONARY_TRIE_H
+
+#include <cstdint>          // for std::uint32_t
+#include <optional>         // for std::optional
+#include <string_view>      // for std::string_view
+#include <vector>           // for std::vector
+
+#include "dictionary.h"
+#include "mapped_dictionary.h"
+
+/**
+ * A read-only prefix tree over the words of a dictionary.
+ *
+ * Rather than allocating each node separately, the trie is stored in a handful
+ * of flat arrays in compressed sparse row form [2]: the outgoing edges of node
+ * i occupy the index range [m_edge_begin[i], m_edge_begin[i + 1]) of the edge
+ * label and edge target arrays, with labels in ascending order. Nodes are
+ * numbered in breadth-first order starting from the root.
+ *
+ * Besides whole-word lookups, the trie can be walked one letter at a time
+ * using step(), which allows a search to stop extending a candidate as soon as
+ * no word begins with it.
+ */
+class DictionaryTrie {
+  public:
+    /// Type used to identify nodes of the trie.
+    using NodeIndex = std::uint32_t;
+
+    /// The node corresponding to the empty prefix.
+    constexpr static NodeIndex k_root{0};
+
+  private:
+    /// Index of the first outgoing edge of each node, plus a final end index.
+    std::vector<std::uint32_t> m_edge_begin;
+
+    /// The letter on each edge.
+    std::vector<char> m_edge_labels;
+
+    /// The node that each edge leads to.
+    std::vector<NodeIndex> m_edge_targets;
+
+    /// Whether the prefix represented by each node is a dictionary word.
+    std::vector<bool> m_terminal;
+
+  public:
+    /// Creates a trie containing every word in the given dictionary.
+    explicit DictionaryTrie(const Dictionary& dictionary);
+
+    /// Creates a trie containing every word in the given compiled dictionary.
+    explicit DictionaryTrie(const MappedDictionary& dictionary);
+
+    /**
+     * Follows the edge labelled `letter` out of the given node.
+     *
+     * @return Node for the extended prefix, or std::nullopt if no word begins
+     *         with the extended prefix.
+     */
+    [[nodiscard]] std::optional<NodeIndex> step(NodeIndex node, char letter) const;
+
+    /**
+     * Walks the given prefix starting from the specified node.
+     *
+     * @return Node for the prefix, or std::nullopt if no word begins with it.
+     */
+    [[nodiscard]] std::optional<NodeIndex> find_prefix(std::string_view prefix, NodeIndex node = k_root) const;
+
+    /// Returns true if the prefix represented by the given node is a word.
+    [[nodiscard]] bool is_word(NodeIndex node) const { return m_terminal[node]; }
+
+    /// Returns true if at least one word in this trie begins with the given prefix.
+    [[nodiscard]] bool has_prefix(std::string_view prefix) const { return find_prefix(prefix).has_value(); }
+
+    /// Returns true if the given word is contained in this trie.
+    [[nodiscard]] bool contains(std::string_view key) const;
+
+    /**
+     * Calls `visit(label, child)` for each outgoing edge of the given node, in
+     * ascending order of label.
+     */
+    template<typename Visitor>
+    void for_each_child(NodeIndex node, Visitor visit) const
+    {
+        for (auto edge = m_edge_begin[node]; edge != m_edge_begin[node + 1]; ++edge) {
+            visit(m_edge_labels[edge], m_edge_targets[edge]);
+        }
+    }
+
+    /// Returns the number of nodes in this trie.
+    [[nodiscard]] std::size_t node_count() const { return m_terminal.size(); }
+
+  private:
+    /**
+     * Builds this trie from the given sorted sequence of words.
+     *
+     * @tparam Words Type providing size() and operator[] for accessing words,
+     *               which in turn provide size() and operator[].
+     */
+    template<typename Words>
+    void build(const Words& words);
+};
+
+#endif //EECE_2560_PROJECTS_DICTIONARY_TRIE_H
@@ -0,0 +1,185 @@
+/**
+ * Hash table dictionary definitions for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#include "hash_dictionary.h"
+
+#include <cstring>          // for std::memcmp
+#include <fstream>          // for std::ifstream, std::ofstream
+#include <stdexcept>        // for std::runtime_error
+
+namespace {
+
+/// Identifies hash dictionary files.
+constexpr char k_file_magic[8]{'E', 'E', 'C', 'E', 'H', 'A', 'S', 'H'};
+
+/// The version of the hash dictionary file layout.
+constexpr std::uint32_t k_file_version{1};
+
+/**
+ * Fixed-size header at the start of a hash dictionary file.
+ *
+ * The header is followed by the offset table (word_count + 1 entries), the
+ * slot table (slot_count entries) and the character blob (blob_size bytes).
+ */
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t word_count;
+    std::uint32_t slot_count;
+    std::uint32_t blob_size;
+};
+
+/// Writes the elements of the given vector to the stream as raw bytes.
+template<typename T>
+void write_raw(std::ostream& out, const std::vector<T>& values)
+{
+    out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+/// Reads raw bytes from the stream into the elements of the given vector.
+template<typename T>
+void read_raw(std::istream& in, std::vector<T>& values)
+{
+    in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+} // end namespace
+
+HashDictionary::HashDictionary(const Dictionary& dictionary)
+{
+    const auto& words = dictionary.words();
+
+    // The dictionary words are sorted, so duplicates are adjacent.
+    for (std::size_t i{0}; i < words.size(); ++i) {
+        if (i > 0 && words[i] == words[i - 1]) {
+            continue;
+        }
+        m_blob += words[i];
+        m_offsets.push_back(static_cast<std::uint32_t>(m_blob.size()));
+    }
+
+    // Keep the table at most half full.
+    std::size_t slot_count{1};
+    while (slot_count < 2 * size()) {
+        slot_count *= 2;
+    }
+    m_slots.assign(slot_count, Slot{0, k_empty, 0});
+
+    const auto mask = slot_count - 1;
+    for (std::uint32_t index{0}; index < size(); ++index) {
+        const auto hash = fnv1a_hash(word(index));
+        auto slot = static_cast<std::size_t>(hash) & mask;
+        while (m_slots[slot].word != k_empty) {
+            slot = (slot + 1) & mask;
+        }
+        m_slots[slot] = Slot{hash, index, 0};
+    }
+}
+
+bool HashDictionary::contains(std::string_view key) const
+{
+    const auto hash = fnv1a_hash(key);
+    const auto mask = m_slots.size() - 1;
+
+    // The table is never full, so probing always reaches an empty slot.
+    for (auto slot = static_cast<std::size_t>(hash) & mask; m_slots[slot].word != k_empty; slot = (slot + 1) & mask) {
+        if (m_slots[slot].hash == hash && word(m_slots[slot].word) == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+HashDictionary HashDictionary::load_file(const char* file_name)
+{
+    std::ifstream in_stream(file_name, std::ios::binary | std::ios::ate);
+    if (!in_stream) {
+        throw std::runtime_error("hash dictionary file does not exist");
+    }
+    const auto file_size = static_cast<std::uint64_t>(in_stream.tellg());
+    in_stream.seekg(0);
+
+    FileHeader header{};
+    in_stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!in_stream || std::memcmp(header.magic, k_file_magic, sizeof(k_file_magic)) != 0) {
+        throw std::runtime_error("not a hash dictionary file");
+    }
+    if (header.version != k_file_version) {
+        throw std::runtime_error("unsupported hash dictionary file version");
+    }
+    // The slot count must be a power of two exceeding the word count.
+    if (header.slot_count == 0 || (header.slot_count & (header.slot_count - 1)) != 0
+        || header.slot_count <= header.word_count) {
+        throw std::runtime_error("corrupt hash dictionary file");
+    }
+    // Check the table sizes against the file before allocating them, so that a
+    // corrupt header cannot request an arbitrarily large allocation.
+    const std::uint64_t expected_size = sizeof(header)
+        + (std::uint64_t{header.word_count} + 1) * sizeof(std::uint32_t)
+        + std::uint64_t{header.slot_count} * sizeof(Slot)
+        + header.blob_size;
+    if (file_size != expected_size) {
+        throw std::runtime_error("corrupt hash dictionary file");
+    }
+
+    HashDictionary result;
+    result.m_offsets.resize(std::size_t{header.word_count} + 1);
+    result.m_slots.resize(header.slot_count);
+    result.m_blob.resize(header.blob_size);
+
+    read_raw(in_stream, result.m_offsets);
+    read_raw(in_stream, result.m_slots);
+    in_stream.read(result.m_blob.data(), static_cast<std::streamsize>(result.m_blob.size()));
+
+    if (!in_stream) {
+        throw std::runtime_error("corrupt hash dictionary file");
+    }
+
+    // Validate the tables so that lookups can never index out of bounds.
+    for (std::size_t i{0}; i < header.word_count; ++i) {
+        if (result.m_offsets[i] > result.m_offsets[i + 1]) {
+            throw std::runtime_error("corrupt hash dictionary file");
+        }
+    }
+    bool has_empty_slot{false};
+    for (const auto& slot : result.m_slots) {
+        has_empty_slot = has_empty_slot || slot.word == k_empty;
+        if (slot.word != k_empty && slot.word >= header.word_count) {
+            throw std::runtime_error("corrupt hash dictionary file");
+        }
+    }
+    if (result.m_offsets.front() != 0 || result.m_offsets.back() != header.blob_size || !has_empty_slot) {
+        throw std::runtime_error("corrupt hash dictionary file");
+    }
+    return result;
+}
+
+void HashDictionary::save_file(const char* file_name) const
+{
+    std::ofstream out_stream(file_name, std::ios::binary);
+    if (!out_stream) {
+        throw std::runtime_error("could not open hash dictionary file for writing");
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, k_file_magic, sizeof(k_file_magic));
+    header.version = k_file_version;
+    header.word_count = static_cast<std::uint32_t>(size());
+    header.slot_count = static_cast<std::uint32_t>(m_slots.size());
+    header.blob_size = static_cast<std::uint32_t>(m_blob.size());
+
+    out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    write_raw(out_stream, m_offsets);
+    write_raw(out_stream, m_slots);
+    out_stream.write(m_blob.data(), static_cast<std::streamsize>(m_blob.size()));
+
+    if (!out_stream) {
+        throw std::runtime_error("could not write hash dictionary file");
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * Hash table dictionary declarations for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+ *  [2] https://en.wikipedia.org/wiki/Open_addressing
+ */
+
+#ifndef EECE_2560_PROJECTS_HASH_DICTIONARY_H
+#define EECE_2560_PROJECTS_HASH_DICTIONARY_H
+
+#include <cstdint>          // for std::uint32_t, std::uint64_t
+#include <limits>           // for std::numeric_limits
+#include <string>           // for std::string
+#include <string_view>      // for std::string_view
+#include <vector>           // for std::vector
+
+#include "dictionary.h"
+
+/// Returns the 64-bit FNV-1a hash of the given string [1].
+constexpr std::uint64_t fnv1a_hash(std::string_view key) noexcept
+{
+    std::uint64_t hash{0xcbf29ce484222325};
+    for (const char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+/**
+ * A set of words backed by an open addressing hash table [2].
+ *
+ * The words are stored back to back in a single character blob, delimited by
+ * an offset table. Each table slot holds the full hash of its word alongside
+ * the word's index, so a lookup costs one hash of the key and, except in the
+ * rare event of a 64-bit hash collision, at most one string comparison.
+ * Collisions between slots are resolved with linear probing, and the table is
+ * kept at most half full.
+ *
+ * The table can be saved to a file and loaded again without rehashing or
+ * re-sorting any words, so that it can be built offline.
+ */
+class HashDictionary {
+    /// A hash table entry.
+    struct Slot {
+        /// The hash of the word in this slot.
+        std::uint64_t hash;
+
+        /// The index of the word in this slot, or k_empty.
+        std::uint32_t word;
+
+        /// Explicit padding so that the file layout has no unspecified bytes.
+        std::uint32_t reserved;
+    };
+
+    /// Marker for slots that hold no word.
+    constexpr static std::uint32_t k_empty{std::numeric_limits<std::uint32_t>::max()};
+
+    /// All words, back to back.
+    std::string m_blob;
+
+    /// Offset of each word in m_blob, plus a final end offset.
+    std::vector<std::uint32_t> m_offsets{0};
+
+    /// The hash table. The number of slots is a power of two.
+    std::vector<Slot> m_slots{Slot{0, k_empty, 0}};
+
+  public:
+    /// Creates a hash dictionary with no words.
+    HashDictionary() = default;
+
+    /// Creates a hash dictionary containing the (normalized) words of the given dictionary.
+    explicit HashDictionary(const Dictionary& dictionary);
+
+    /**
+     * Reads a hash dictionary previously written by save_file().
+     *
+     * @throws std::runtime_error if the file cannot be read or was not
+     *         written by save_file().
+     */
+    static HashDictionary load_file(const char* file_name);
+
+    /**
+     * Writes this hash dictionary to the specified file.
+     *
+     * The file uses the native byte order, so it should be loaded on the
+     * same kind of machine that wrote it.
+     *
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void save_file(const char* file_name) const;
+
+    /// Returns true if the given word is contained in this dictionary.
+    [[nodiscard]] bool contains(std::string_view key) const;
+
+    /// Returns the number of distinct words in this dictionary.
+    [[nodiscard]] std::size_t size() const noexcept { return m_offsets.size() - 1; }
+
+  private:
+    /// Returns the word with the given index.
+    [[nodiscard]] std::string_view word(std::uint32_t index) const noexcept
+    {
+        return {m_blob.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]};
+    }
+};
+
+#endif //EECE_2560_PROJECTS_HASH_DICTIONARY_H
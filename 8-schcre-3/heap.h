@@ -8,49 +8,109 @@
  *  References
  * ===========
  *  [1] https://en.cppreference.com/w/cpp/named_req/Container
+ *  [2] https://doi.org/10.1016/0304-3975(93)90364-Y (Wegener, "Bottom-up-heapsort")
  */
 
 #ifndef EECE_2560_PROJECTS_HEAP_H
 #define EECE_2560_PROJECTS_HEAP_H
 
-#include <algorithm>            // for std::iter_swap
+#include <algorithm>            // for std::iter_swap, std::min
+#include <cstddef>              // for std::size_t
 #include <functional>           // for std::less
 #include <iterator>             // for std::distance, std::iterator_traits
 #include <type_traits>          // for std::is_base_of_v
+#include <utility>              // for std::move
 #include <vector>               // for std::vector
 
 namespace details {
+/// Returns the index of the parent of the entry at the given index in a d-ary heap.
+template<std::size_t Arity, typename Diff>
+constexpr Diff heap_parent_index(Diff index)
+{
+    return (index - 1) / static_cast<Diff>(Arity);
+}
+
+/// Returns the index of the first child of the entry at the given index in a d-ary heap.
+template<std::size_t Arity, typename Diff>
+constexpr Diff heap_first_child_index(Diff index)
+{
+    return static_cast<Diff>(Arity) * index + 1;
+}
+
 /**
- * Returns the "left child" of the given position in the heap.
- *
- * If the left child does not exist, the end iterator of the range will be
- * returned. This function avoids undefined behavior from incrementing an
- * end iterator.
+ * Returns the index of the largest of the children of a d-ary heap entry,
+ * given the index of its first child. At least one child must exist.
  */
-template<typename Iter>
-constexpr Iter heap_child_left(Iter start, Iter end, Iter pos)
+template<std::size_t Arity, typename Iter, typename Compare>
+typename std::iterator_traits<Iter>::difference_type heap_largest_child(
+    Iter heap_start,
+    typename std::iterator_traits<Iter>::difference_type first_child,
+    typename std::iterator_traits<Iter>::difference_type size,
+    Compare& comp)
 {
-    auto next_index = 2 * (std::distance(start, pos) + 1) - 1;
-    // We cannot increment a random access iterator past its end value.
-    if (next_index <= std::distance(start, end)) {
-        return start + next_index;
-    } else {
-        return end;
+    using Diff = typename std::iterator_traits<Iter>::difference_type;
+    const Diff last_child = std::min(first_child + static_cast<Diff>(Arity), size);
+    Diff largest = first_child;
+    for (Diff child = first_child + 1; child < last_child; ++child) {
+        if (comp(heap_start[largest], heap_start[child])) {
+            largest = child;
+        }
     }
+    return largest;
 }
 
 /**
- * Returns the "right child" of the given position in the heap.
+ * Moves the entry at `current` down a d-ary heap until it is no less than
+ * its children, assuming that all of the branches below `current` already
+ * satisfy the heap property.
  *
- * If the right child does not exist, the end iterator of the range will be
- * returned. This function avoids undefined behavior from incrementing an
- * end iterator.
+ * Rather than swapping at every level, the entry is held aside while larger
+ * children are moved up into the hole it leaves, and is written once at its
+ * final position.
  */
-template<typename Iter>
-constexpr Iter heap_child_right(Iter start, Iter end, Iter pos)
+template<std::size_t Arity, typename Iter, typename Compare>
+void heap_sift_down(Iter heap_start, Iter heap_end, Iter current, Compare& comp)
+{
+    using Diff = typename std::iterator_traits<Iter>::difference_type;
+    const Diff size = heap_end - heap_start;
+    Diff hole = current - heap_start;
+
+    auto value = std::move(heap_start[hole]);
+    while (true) {
+        const Diff first_child = details::heap_first_child_index<Arity>(hole);
+        if (first_child >= size) {
+            break;
+        }
+        const Diff largest = details::heap_largest_child<Arity>(heap_start, first_child, size, comp);
+        if (!comp(value, heap_start[largest])) {
+            break;
+        }
+        heap_start[hole] = std::move(heap_start[largest]);
+        hole = largest;
+    }
+    heap_start[hole] = std::move(value);
+}
+
+/**
+ * Moves the entry at `current` up a d-ary heap until it is no greater than
+ * its parent, assuming that the rest of the range satisfies the heap property.
+ */
+template<std::size_t Arity, typename Iter, typename Compare>
+void heap_sift_up(Iter heap_start, Iter current, Compare& comp)
 {
-    auto sibling = details::heap_child_left(start, end, pos);
-    return sibling == end ? sibling : sibling + 1;
+    using Diff = typename std::iterator_traits<Iter>::difference_type;
+    Diff hole = current - heap_start;
+
+    auto value = std::move(heap_start[hole]);
+    while (hole > 0) {
+        const Diff parent = details::heap_parent_index<Arity>(hole);
+        if (!comp(heap_start[parent], value)) {
+            break;
+        }
+        heap_start[hole] = std::move(heap_start[parent]);
+        hole = parent;
+    }
+    heap_start[hole] = std::move(value);
 }
 
 /**
@@ -64,24 +124,70 @@ void heapify_branch(Iter heap_start, Iter heap_end, Iter current, Compare comp)
     using category = typename std::iterator_traits<Iter>::iterator_category;
     static_assert(std::is_base_of_v<std::random_access_iterator_tag, category>);
 
-    auto largest = current;
-    const auto left = details::heap_child_left(heap_start, heap_end, current);
-    const auto right = details::heap_child_right(heap_start, heap_end, current);
+    details::heap_sift_down<2>(heap_start, heap_end, current, comp);
+}
+} // end namespace details
 
-    if (left < heap_end && comp(*largest, *left)) {
-        largest = left;
+/**
+ * Produces a max-heap in the given range in which every entry has up to
+ * `Arity` children.
+ *
+ * Wider heaps are shallower, so entries move through fewer levels when they
+ * are pushed or popped, at the cost of more comparisons per level. Since the
+ * children of an entry are adjacent, each level also touches fewer cache lines.
+ *
+ * @tparam Arity The number of children of each entry.
+ * @tparam Iter Random iterator type.
+ * @tparam Compare Callable type to compare elements.
+ * @param start,end Range to be turned into a max heap.
+ * @param comp Binary functor that returns true when its first argument
+ *             compares less than its second.
+ */
+template<std::size_t Arity, typename Iter, typename Compare = std::less<>>
+void dary_heapify(Iter start, Iter end, Compare comp = Compare())
+{
+    // Ensure the iterator supports random access.
+    using category = typename std::iterator_traits<Iter>::iterator_category;
+    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category>);
+    static_assert(Arity >= 2, "heap entries must have at least two children");
+
+    const auto size = end - start;
+    if (size < 2) {
+        return;
     }
-    if (right < heap_end && comp(*largest, *right)) {
-        largest = right;
+    // Iterate over every entry with children, bottom-up.
+    auto index = details::heap_parent_index<Arity>(size - 1);
+    while (index >= 0) {
+        details::heap_sift_down<Arity>(start, end, start + index, comp);
+        --index;
     }
+}
 
-    if (largest != current) {
-        std::iter_swap(current, largest);
-        // Expected tail call optimization.
-        heapify_branch(heap_start, heap_end, largest, comp);
+/**
+ * Adds the last entry in the given range to the d-ary max-heap formed by the
+ * entries before it.
+ */
+template<std::size_t Arity, typename Iter, typename Compare = std::less<>>
+void dary_push_heap(Iter start, Iter end, Compare comp = Compare())
+{
+    if (end - start > 1) {
+        details::heap_sift_up<Arity>(start, end - 1, comp);
+    }
+}
+
+/**
+ * Moves the largest entry of the given d-ary max-heap to the end of the range
+ * and restores the heap property among the remaining entries.
+ */
+template<std::size_t Arity, typename Iter, typename Compare = std::less<>>
+void dary_pop_heap(Iter start, Iter end, Compare comp = Compare())
+{
+    if (end - start > 1) {
+        --end;
+        std::iter_swap(start, end);
+        details::heap_sift_down<Arity>(start, end, start, comp);
     }
 }
-} // end namespace details
 
 /**
  * Produces a max-heap in the given range.
@@ -95,20 +201,7 @@ void heapify_branch(Iter heap_start, Iter heap_end, Iter current, Compare comp)
 template<typename Iter, typename Compare = std::less<>>
 void heapify(Iter start, Iter end, Compare comp = Compare())
 {
-    // Ensure the iterator supports random access.
-    using category = typename std::iterator_traits<Iter>::iterator_category;
-    static_assert(std::is_base_of_v<std::random_access_iterator_tag, category>);
-
-    // Index of the bottom-right move branch with children. The difference type
-    // of the iterator will be a signed type, so we do not have to worry about
-    // underflow.
-    auto index = (end - start) / 2 - 1;
-
-    // Iterate over [0, index) in reverse.
-    while (index >= 0) {
-        details::heapify_branch(start, end, start + index, comp);
-        --index;
-    }
+    dary_heapify<2>(start, end, comp);
 }
 
 /**
@@ -139,68 +232,187 @@ void heap_sort_unstable(Iter start, Iter end, Compare comp = Compare())
 
 }
 
+/**
+ * Sorts the given range using Floyd's bottom-up variant of heapsort [2].
+ *
+ * When the root is removed, the entry that replaces it almost always belongs
+ * near the bottom of the heap. Instead of comparing it against the children
+ * at every level on the way down, the hole left by the root is moved all the
+ * way down along the path of larger children, and the entry is then sifted up
+ * from the leaf. This needs close to one comparison per level rather than
+ * two, which matters when comparisons are expensive (e.g. strings).
+ *
+ * This heapsort implementation is unstable.
+ *
+ * @tparam Iter Random iterator type.
+ * @tparam Compare Callable type to compare elements.
+ * @param start,end Range to be sorted.
+ * @param comp Binary functor that returns true when its first argument
+ *             compares less than its second.
+ */
+template<typename Iter, typename Compare = std::less<>>
+void heap_sort_bottom_up(Iter start, Iter end, Compare comp = Compare())
+{
+    using Diff = typename std::iterator_traits<Iter>::difference_type;
+
+    heapify(start, end, comp);
+
+    for (Diff size = end - start; size > 1; --size) {
+        // Remove the last entry to make room for the current root.
+        auto value = std::move(start[size - 1]);
+        start[size - 1] = std::move(start[0]);
+        const Diff heap_size = size - 1;
+
+        // Walk the hole at the root down to a leaf along the larger children.
+        Diff hole{0};
+        while (true) {
+            const Diff first_child = details::heap_first_child_index<2>(hole);
+            if (first_child >= heap_size) {
+                break;
+            }
+            const Diff largest = details::heap_largest_child<2>(start, first_child, heap_size, comp);
+            start[hole] = std::move(start[largest]);
+            hole = largest;
+        }
+
+        // Place the removed entry in the hole and sift it back up.
+        start[hole] = std::move(value);
+        details::heap_sift_up<2>(start, start + hole, comp);
+    }
+}
+
 /**
  * A heap that owns it entries.
  *
- * This class implements the required heap interface for project 3b.
+ * This class implements the required heap interface for project 3b. It also
+ * supports push(), pop() and top(), so it can serve as a general max-priority
+ * queue.
  *
  * @tparam Container Random access container used to store heap elements.
  * @tparam Compare Callable type that imposes an ordering among elements.
+ * @tparam Arity The number of children of each heap entry.
  */
-template<typename Container, typename Compare = std::less<>>
+template<typename Container, typename Compare = std::less<>, std::size_t Arity = 2>
 class OwningHeap {
     // Ensure the Container type supports random access iteration.
     static_assert(std::is_base_of_v<
         std::random_access_iterator_tag,
         typename std::iterator_traits<typename Container::iterator>::iterator_category
     >);
+    static_assert(Arity >= 2, "heap entries must have at least two children");
 
     // Type alias for C++ container [1].
     using const_iterator = typename Container::const_iterator;
 
+  public:
+    // Type aliases for C++ container [1].
+    using value_type = typename Container::value_type;
+    using size_type = typename Container::size_type;
+
+  private:
     /// The entries of this heap.
     Container m_values;
 
     /// The binary functor used to compare heap elements.
     Compare m_compare;
 
+    /// Set when sort() has left the entries in ascending order.
+    bool m_sorted{false};
+
   public:
     /// Creates an OwningHeap with the given entries using the specified comparison function.
-    explicit OwningHeap(Container values, Compare comp = Compare()) : m_values(std::move(values))
+    explicit OwningHeap(Container values = Container(), Compare comp = Compare())
+        : m_values(std::move(values)), m_compare(std::move(comp))
     {
-        heapify(std::begin(m_values), std::end(m_values), comp);
+        dary_heapify<Arity>(std::begin(m_values), std::end(m_values), m_compare);
     }
 
     /// Creates an OwningHeap from the values in the given iterator range
     /// using the specified comparison function.
     template<typename Iter>
     OwningHeap(Iter start, Iter end, Compare comp = Compare())
-        : OwningHeap(std::vector(start, end), comp) {}
+        : OwningHeap(Container(start, end), std::move(comp)) {}
 
+    /**
+     * Sorts the entries of this heap in ascending order.
+     *
+     * A range sorted in ascending order is not a max-heap, so the heap is
+     * rebuilt by the next call to push(), pop() or sort().
+     */
     void sort()
     {
-        heap_sort_unstable(std::begin(m_values), std::end(m_values), m_compare);
+        // The d-ary sort below pops from the entries in place, so they must form a heap.
+        restore();
+        if constexpr (Arity == 2) {
+            heap_sort_bottom_up(std::begin(m_values), std::end(m_values), m_compare);
+        } else {
+            for (auto end = std::end(m_values); end != std::begin(m_values); --end) {
+                dary_pop_heap<Arity>(std::begin(m_values), end, m_compare);
+            }
+        }
+        m_sorted = true;
+    }
+
+    /// Returns true if this heap has no entries.
+    [[nodiscard]] bool empty() const noexcept { return m_values.empty(); }
+
+    /// Returns the number of entries in this heap.
+    [[nodiscard]] size_type size() const noexcept { return m_values.size(); }
+
+    /// Returns the largest entry in this heap. The heap must not be empty.
+    [[nodiscard]] const value_type& top() const { return m_sorted ? m_values.back() : m_values.front(); }
+
+    /// Adds the given value to this heap.
+    void push(value_type value)
+    {
+        restore();
+        m_values.push_back(std::move(value));
+        dary_push_heap<Arity>(std::begin(m_values), std::end(m_values), m_compare);
+    }
+
+    /// Removes and returns the largest entry in this heap. The heap must not be empty.
+    value_type pop()
+    {
+        restore();
+        dary_pop_heap<Arity>(std::begin(m_values), std::end(m_values), m_compare);
+        value_type result = std::move(m_values.back());
+        m_values.pop_back();
+        return result;
     }
 
     [[nodiscard]]
-    /// Returns the "parent" of the given position in the heap.
+    /// Returns the "parent" of the given position in the heap. The root is its own parent.
     const_iterator parent(const_iterator pos) const
     {
-        return std::begin(m_values) + (std::distance(std::begin(m_values), pos) / 2);
+        const auto index = std::distance(std::begin(m_values), pos);
+        return index == 0 ? pos : std::begin(m_values) + details::heap_parent_index<Arity>(index);
     }
 
     [[nodiscard]]
     /// Returns the "left child" of the given position in the heap.
     const_iterator left(const_iterator pos) const
     {
-        return details::heap_child_left(std::begin(m_values), std::end(m_values), pos);
+        return child(pos, 0);
     }
 
     [[nodiscard]]
-    /// Returns the "right child" of the given position in the heap.
+    /// Returns the "right child" of the given position in the heap, i.e. the
+    /// second child if the heap is not binary.
     const_iterator right(const_iterator pos) const
     {
-        return details::heap_child_right(std::begin(m_values), std::end(m_values), pos);
+        return child(pos, 1);
+    }
+
+    [[nodiscard]]
+    /// Returns the child with the given rank (in [0, Arity)) of the given
+    /// position in the heap, or the end iterator if it does not exist.
+    const_iterator child(const_iterator pos, std::size_t rank) const
+    {
+        const auto index = details::heap_first_child_index<Arity>(std::distance(std::begin(m_values), pos))
+            + static_cast<typename Container::difference_type>(rank);
+        return index < std::distance(std::begin(m_values), std::end(m_values))
+            ? std::begin(m_values) + index
+            : std::end(m_values);
     }
 
     /// Returns an iterator to the first element of this heap's underlying storage.
@@ -208,6 +420,16 @@ class OwningHeap {
 
     /// Returns the end iterator of this heap's underlying storage.
     [[nodiscard]] const_iterator end() const noexcept { return std::end(m_values); }
+
+  private:
+    /// Rebuilds the heap if it was sorted.
+    void restore()
+    {
+        if (m_sorted) {
+            dary_heapify<Arity>(std::begin(m_values), std::end(m_values), m_compare);
+            m_sorted = false;
+        }
+    }
 };
 
 // Template argument deduction guide for range constructor.
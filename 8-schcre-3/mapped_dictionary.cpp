@@ -0,0 +1,253 @@
+/**
+ * Memory-mapped compiled dictionary definitions for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#include "mapped_dictionary.h"
+
+#include <fstream>          // for std::ifstream, std::ofstream
+#include <stdexcept>        // for std::runtime_error
+#include <utility>          // for std::exchange, std::move
+
+#if defined(__unix__) || defined(__APPLE__)
+#define EECE2560_HAVE_MMAP
+#include <fcntl.h>          // for open
+#include <sys/mman.h>       // for mmap, munmap
+#include <sys/stat.h>       // for fstat
+#include <unistd.h>         // for close
+#endif
+
+namespace {
+
+/// Identifies compiled dictionary files.
+constexpr char k_file_magic[8]{'E', 'E', 'C', 'E', 'D', 'I', 'C', 'T'};
+
+/// The version of the compiled dictionary file layout.
+constexpr std::uint32_t k_file_version{1};
+
+/**
+ * Fixed-size header at the start of a compiled dictionary file.
+ *
+ * The header is followed by the offset table (word_count + 1 entries of type
+ * std::uint32_t) and the character blob (blob_size bytes).
+ */
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t word_count;
+    std::uint32_t blob_size;
+    std::uint32_t reserved;
+};
+
+} // end namespace
+
+MappedDictionary::MappedDictionary(const char* file_name)
+{
+#ifdef EECE2560_HAVE_MMAP
+    const int fd = ::open(file_name, O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("compiled dictionary file does not exist");
+    }
+    struct stat status{};
+    if (::fstat(fd, &status) != 0) {
+        ::close(fd);
+        throw std::runtime_error("could not read compiled dictionary file");
+    }
+    m_size = static_cast<std::size_t>(status.st_size);
+    if (m_size > 0) {
+        void* mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            m_data = static_cast<const char*>(mapping);
+            m_mapped = true;
+        }
+    }
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+#endif
+
+    if (!m_mapped) {
+        std::ifstream in_stream(file_name, std::ios::binary | std::ios::ate);
+        if (!in_stream) {
+            throw std::runtime_error("compiled dictionary file does not exist");
+        }
+        m_buffer.resize(static_cast<std::size_t>(in_stream.tellg()));
+        in_stream.seekg(0);
+        in_stream.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        if (!in_stream) {
+            throw std::runtime_error("could not read compiled dictionary file");
+        }
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+    }
+
+    // Only the header and the table bounds are checked, so that opening the
+    // dictionary does not touch every page of the file.
+    FileHeader header{};
+    if (m_size < sizeof(header)) {
+        release();
+        throw std::runtime_error("not a compiled dictionary file");
+    }
+    std::memcpy(&header, m_data, sizeof(header));
+    if (std::memcmp(header.magic, k_file_magic, sizeof(k_file_magic)) != 0) {
+        release();
+        throw std::runtime_error("not a compiled dictionary file");
+    }
+    if (header.version != k_file_version) {
+        release();
+        throw std::runtime_error("unsupported compiled dictionary file version");
+    }
+
+    const std::size_t table_size = (std::size_t{header.word_count} + 1) * sizeof(std::uint32_t);
+    if (m_size != sizeof(header) + table_size + header.blob_size) {
+        release();
+        throw std::runtime_error("corrupt compiled dictionary file");
+    }
+
+    m_word_count = header.word_count;
+    m_offsets = m_data + sizeof(header);
+    m_blob = m_offsets + table_size;
+    m_blob_size = header.blob_size;
+
+    if (offset(0) != 0 || offset(m_word_count) != header.blob_size) {
+        release();
+        throw std::runtime_error("corrupt compiled dictionary file");
+    }
+}
+
+MappedDictionary::MappedDictionary(MappedDictionary&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedDictionary& MappedDictionary::operator=(MappedDictionary&& other) noexcept
+{
+    if (this != &other) {
+        release();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_mapped = std::exchange(other.m_mapped, false);
+        // Moving a vector keeps its storage, so views into it stay valid.
+        m_buffer = std::move(other.m_buffer);
+        m_word_count = std::exchange(other.m_word_count, 0);
+        m_offsets = std::exchange(other.m_offsets, nullptr);
+        m_blob = std::exchange(other.m_blob, nullptr);
+        m_blob_size = std::exchange(other.m_blob_size, 0);
+    }
+    return *this;
+}
+
+MappedDictionary::~MappedDictionary()
+{
+    release();
+}
+
+void MappedDictionary::release() noexcept
+{
+#ifdef EECE2560_HAVE_MMAP
+    if (m_mapped) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_buffer.clear();
+    m_word_count = 0;
+    m_offsets = nullptr;
+    m_blob = nullptr;
+    m_blob_size = 0;
+}
+
+bool MappedDictionary::contains(std::string_view key) const
+{
+    // Find the first word that does not compare less than the key.
+    std::size_t first{0};
+    std::size_t count{m_word_count};
+    while (count > 0) {
+        const std::size_t half = count / 2;
+        if ((*this)[first + half] < key) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+    return first < m_word_count && (*this)[first] == key;
+}
+
+std::optional<MappedDictionary::PrefixRange> MappedDictionary::step(PrefixRange range, char letter) const
+{
+    // The words in the range share their first `depth` letters, so they are
+    // ordered by the letter that follows, with a word that ends after the
+    // shared prefix first. Letters are compared as unsigned chars, as in the
+    // ordering of std::string.
+    const auto next_letter = [this, depth = range.depth](std::size_t index) {
+        const auto word = (*this)[index];
+        return word.size() > depth ? static_cast<int>(static_cast<unsigned char>(word[depth])) : -1;
+    };
+    const auto target = static_cast<int>(static_cast<unsigned char>(letter));
+
+    // Returns the first index in [first, last) whose next letter is not
+    // before the target letter, or not after it when `inclusive` is set.
+    const auto partition = [&](std::size_t first, std::size_t last, bool inclusive) {
+        std::size_t count = last - first;
+        while (count > 0) {
+            const std::size_t half = count / 2;
+            const auto value = next_letter(first + half);
+            if (value < target || (inclusive && value == target)) {
+                first += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        return first;
+    };
+
+    const auto lower = partition(range.first, range.last, false);
+    const auto upper = partition(lower, range.last, true);
+    if (lower == upper) {
+        return std::nullopt;
+    }
+    return PrefixRange{lower, upper, range.depth + 1};
+}
+
+void MappedDictionary::write_file(const Dictionary& dictionary, const char* file_name)
+{
+    const auto& words = dictionary.words();
+
+    // The dictionary words are sorted, so duplicates are adjacent.
+    std::string blob;
+    std::vector<std::uint32_t> offsets{0};
+    for (std::size_t i{0}; i < words.size(); ++i) {
+        if (i > 0 && words[i] == words[i - 1]) {
+            continue;
+        }
+        blob += words[i];
+        offsets.push_back(static_cast<std::uint32_t>(blob.size()));
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, k_file_magic, sizeof(k_file_magic));
+    header.version = k_file_version;
+    header.word_count = static_cast<std::uint32_t>(offsets.size() - 1);
+    header.blob_size = static_cast<std::uint32_t>(blob.size());
+
+    std::ofstream out_stream(file_name, std::ios::binary);
+    if (!out_stream) {
+        throw std::runtime_error("could not open compiled dictionary file for writing");
+    }
+    out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_stream.write(
+        reinterpret_cast<const char*>(offsets.data()),
+        static_cast<std::streamsize>(offsets.size() * sizeof(std::uint32_t))
+    );
+    out_stream.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+    if (!out_stream) {
+        throw std::runtime_error("could not write compiled dictionary file");
+    }
+}
@@ -0,0 +1,169 @@
+/**
+ * Memory-mapped compiled dictionary declarations for project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://man7.org/linux/man-pages/man2/mmap.2.html
+ *  [2] https://isocpp.github.io/CppCoreGuidelines/CppCoreGuidelines
+ */
+
+#ifndef EECE_2560_PROJECTS_MAPPED_DICTIONARY_H
+#define EECE_2560_PROJECTS_MAPPED_DICTIONARY_H
+
+#include <cstdint>          // for std::uint32_t
+#include <cstring>          // for std::memcpy
+#include <optional>         // for std::optional
+#include <string_view>      // for std::string_view
+#include <vector>           // for std::vector
+
+#include "dictionary.h"
+
+/**
+ * A read-only dictionary backed by a compiled dictionary file.
+ *
+ * A compiled dictionary file holds the normalized, sorted and de-duplicated
+ * words of a dictionary as a single character blob, preceded by a table of
+ * the offset of each word in the blob. On POSIX systems the file is mapped
+ * into memory [1], so opening a dictionary takes constant time and no words
+ * are copied; the operating system pages the file in as it is searched. On
+ * other systems the file is read into memory with a single read.
+ *
+ * The words are accessed by index, in sorted order, as string views into the
+ * mapping. Like DictionaryTrie, the dictionary can also be walked one letter
+ * at a time with step(), which narrows a range of words sharing a prefix.
+ *
+ * The words in the file are assumed to be sorted in ascending order without
+ * duplicates, as written by write_file(). contains() and step() binary search
+ * the words and do not check this assumption; only the header and table
+ * bounds are validated when the file is opened, so that opening does not
+ * touch every page of the file.
+ */
+class MappedDictionary {
+    /// The contents of the file.
+    const char* m_data{nullptr};
+
+    /// The size of the file in bytes.
+    std::size_t m_size{0};
+
+    /// Whether m_data refers to a memory mapping (as opposed to m_buffer).
+    bool m_mapped{false};
+
+    /// Storage for the file contents when memory mapping is not available.
+    std::vector<char> m_buffer;
+
+    /// The number of words in the dictionary.
+    std::size_t m_word_count{0};
+
+    /// The offset table, which holds m_word_count + 1 entries.
+    const char* m_offsets{nullptr};
+
+    /// The character blob.
+    const char* m_blob{nullptr};
+
+    /// The size of the character blob in bytes.
+    std::size_t m_blob_size{0};
+
+  public:
+    /// Creates a dictionary with no words.
+    MappedDictionary() = default;
+
+    /**
+     * Opens the specified compiled dictionary file.
+     *
+     * @throws std::runtime_error if the file cannot be opened or is not a
+     *         compiled dictionary file.
+     */
+    explicit MappedDictionary(const char* file_name);
+
+    /*
+     * The mapping is owned uniquely, so this class can be moved but not
+     * copied [C.21,C.81 in 2].
+     */
+    MappedDictionary(const MappedDictionary&) = delete;
+
+    MappedDictionary& operator=(const MappedDictionary&) = delete;
+
+    MappedDictionary(MappedDictionary&& other) noexcept;
+
+    MappedDictionary& operator=(MappedDictionary&& other) noexcept;
+
+    /// Releases the mapping.
+    ~MappedDictionary();
+
+    /**
+     * Writes the words of the given dictionary to the specified file in the
+     * compiled dictionary format.
+     *
+     * The file uses the native byte order, so it should be opened on the
+     * same kind of machine that wrote it.
+     *
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    static void write_file(const Dictionary& dictionary, const char* file_name);
+
+    /// Returns the number of words in this dictionary.
+    [[nodiscard]] std::size_t size() const noexcept { return m_word_count; }
+
+    /// Returns the word with the given index. Words are indexed in sorted order.
+    [[nodiscard]] std::string_view operator[](std::size_t index) const noexcept
+    {
+        const auto begin = offset(index);
+        const auto end = offset(index + 1);
+        if (begin > end || end > m_blob_size) {
+            // Only reachable with a corrupt file, since the offsets are not
+            // all validated when the file is opened.
+            return {};
+        }
+        return {m_blob + begin, end - begin};
+    }
+
+    /// Returns true if the given word is contained in this dictionary.
+    [[nodiscard]] bool contains(std::string_view key) const;
+
+    /// The range [first, last) of indices of the words that begin with a prefix.
+    struct PrefixRange {
+        std::size_t first;
+        std::size_t last;
+
+        /// The length of the shared prefix.
+        std::size_t depth;
+    };
+
+    /// Returns the range of all words, which share the empty prefix.
+    [[nodiscard]] PrefixRange prefix_root() const noexcept { return {0, m_word_count, 0}; }
+
+    /**
+     * Returns the range of words that extend the prefix of the given range
+     * with the given letter, or std::nullopt if no word does.
+     *
+     * Runs in O(log N) time in the size of the given range.
+     */
+    [[nodiscard]] std::optional<PrefixRange> step(PrefixRange range, char letter) const;
+
+    /// Returns true if the prefix of the given range is itself a word.
+    [[nodiscard]] bool is_word(PrefixRange range) const noexcept
+    {
+        // A word equal to the shared prefix sorts before its extensions.
+        return range.first < range.last && (*this)[range.first].size() == range.depth;
+    }
+
+  private:
+    /// Returns the entry of the offset table at the given index.
+    [[nodiscard]] std::size_t offset(std::size_t index) const noexcept
+    {
+        // The mapping is not a std::uint32_t array as far as the language is
+        // concerned, so copy the bytes rather than casting the pointer.
+        std::uint32_t value;
+        std::memcpy(&value, m_offsets + index * sizeof(value), sizeof(value));
+        return value;
+    }
+
+    /// Releases the mapping, leaving this dictionary empty.
+    void release() noexcept;
+};
+
+#endif //EECE_2560_PROJECTS_MAPPED_DICTIONARY_H
@@ -0,0 +1,330 @@
+/**
+ * Precomputed wrap-around grid lines for producing word search candidates
+ * without copying in project 3.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ===========
+ *  [1] https://en.cppreference.com/w/cpp/iterator/iterator_traits
+ *  [2] https://en.cppreference.com/w/cpp/string/basic_string_view
+ */
+
+#ifndef EECE_2560_PROJECTS_ORDINAL_WRAPPING_LINES_H
+#define EECE_2560_PROJECTS_ORDINAL_WRAPPING_LINES_H
+
+#include <array>                // for std::array
+#include <cstdint>              // for std::uint32_t
+#include <string>               // for std::string
+#include <string_view>          // for std::string_view
+#include <vector>               // for std::vector
+
+#include "matrix.h"
+#include "ordinal_wrapping_sequence.h"
+
+/**
+ * The wrap-around lines of a grid of letters along each ordinal direction.
+ *
+ * Stepping from any entry in a fixed direction eventually wraps back around
+ * to that entry, so for each direction the entries of the grid split into
+ * cycles, called lines. The letters of each line are stored once, doubled
+ * (less one letter) in a single shared buffer, so that every sequence of up
+ * to line-length letters that starts anywhere on the line is a contiguous
+ * slice of the buffer.
+ */
+class OrdinalWrappingLines {
+  public:
+    /// Type used to access entries of the grid.
+    using Coordinate = Matrix<char>::Coordinate;
+
+    /// A single wrap-around line of the grid.
+    struct Line {
+        /// Offset of the line's doubled letters in the shared buffer.
+        std::size_t offset;
+
+        /// The number of distinct entries on the line.
+        std::size_t length;
+
+        /// The entry whose letter begins the line.
+        Coordinate origin;
+
+        /// The direction in which the line is traversed.
+        OrdinalDirection direction;
+    };
+
+  private:
+    /// Locates an entry on the line through it in some direction.
+    struct EntryRef {
+        /// Index of the line in m_lines.
+        std::uint32_t line;
+
+        /// Position of the entry's letter within the line.
+        std::uint32_t index;
+    };
+
+    /// The dimensions of the grid.
+    Coordinate m_dims{};
+
+    /// The doubled letters of every line, back to back.
+    std::string m_buffer;
+
+    /// Every line of the grid, grouped by direction.
+    std::vector<Line> m_lines;
+
+    /// For each direction, the location of each entry (in row-major order) on
+    /// the line through it.
+    std::array<std::vector<EntryRef>, k_ordinal_directions.size()> m_entry_refs;
+
+  public:
+    /// Creates an empty set of lines.
+    OrdinalWrappingLines() = default;
+
+    /// Precomputes the lines of the given grid.
+    explicit OrdinalWrappingLines(const Matrix<char>& grid) : m_dims(grid.dimensions())
+    {
+        const auto[rows, cols] = m_dims;
+        const auto entry_count = rows * cols;
+
+        // Every entry appears once in each direction, doubled less one letter per line.
+        m_buffer.reserve(2 * k_ordinal_directions.size() * entry_count);
+
+        for (std::size_t d{0}; d < k_ordinal_directions.size(); ++d) {
+            const auto dir = k_ordinal_directions[d];
+            auto& refs = m_entry_refs[d];
+            refs.assign(entry_count, EntryRef{0, 0});
+            std::vector<bool> visited(entry_count, false);
+
+            for (std::size_t entry{0}; entry < entry_count; ++entry) {
+                if (visited[entry]) {
+                    continue;
+                }
+
+                const Coordinate origin{entry / cols, entry % cols};
+                const auto offset = m_buffer.size();
+                const auto line_index = static_cast<std::uint32_t>(m_lines.size());
+
+                // Walk the cycle containing this entry, recording the first copy.
+                std::uint32_t index{0};
+                Coordinate pos = origin;
+                do {
+                    const auto flat = pos.first * cols + pos.second;
+                    visited[flat] = true;
+                    refs[flat] = EntryRef{line_index, index};
+                    m_buffer.push_back(grid[pos]);
+                    ++index;
+                    pos = wrapping_step(pos, dir, m_dims);
+                } while (pos != origin);
+
+                // Append the second copy, less its final letter.
+                const std::size_t length = index;
+                for (std::size_t i{0}; i + 1 < length; ++i) {
+                    m_buffer.push_back(m_buffer[offset + i]);
+                }
+                m_lines.push_back(Line{offset, length, origin, dir});
+            }
+        }
+    }
+
+    /// Returns the dimensions of the underlying grid.
+    [[nodiscard]] Coordinate dimensions() const noexcept { return m_dims; }
+
+    /// Returns every line of the grid.
+    [[nodiscard]] const std::vector<Line>& lines() const noexcept { return m_lines; }
+
+    /**
+     * Returns the doubled letters of the given line. The view holds
+     * 2 * line.length - 1 letters.
+     */
+    [[nodiscard]] std::string_view text(const Line& line) const noexcept
+    {
+        return {m_buffer.data() + line.offset, 2 * line.length - 1};
+    }
+
+    /// Returns the grid position of the letter at the given index of a line's text.
+    [[nodiscard]] Coordinate position(const Line& line, std::size_t index) const noexcept
+    {
+        const auto steps = index % line.length;
+        const auto[row_offset, col_offset] = ordinal_offset(line.direction);
+
+        // Moving -1 along an axis of extent n is the same as moving n - 1.
+        const auto move = [steps](std::size_t start, int offset, std::size_t extent) {
+            const std::size_t delta = offset < 0 ? extent - 1 : static_cast<std::size_t>(offset);
+            return (start + (steps % extent) * delta) % extent;
+        };
+        return {move(line.origin.first, row_offset, m_dims.first), move(line.origin.second, col_offset, m_dims.second)};
+    }
+
+    /// Returns the number of distinct entries on the line through `start` in the given direction.
+    [[nodiscard]] std::size_t line_length(Coordinate start, OrdinalDirection dir) const
+    {
+        return m_lines[entry_ref(start, dir).line].length;
+    }
+
+    /**
+     * Returns the sequence of `length` letters that starts at the given entry
+     * and extends in the given direction.
+     *
+     * `length` must not exceed line_length(start, dir).
+     */
+    [[nodiscard]] std::string_view sequence(Coordinate start, OrdinalDirection dir, std::size_t length) const
+    {
+        const auto ref = entry_ref(start, dir);
+        return {m_buffer.data() + m_lines[ref.line].offset + ref.index, length};
+    }
+
+  private:
+    /// Returns the location of the given entry on the line through it in the given direction.
+    [[nodiscard]] EntryRef entry_ref(Coordinate pos, OrdinalDirection dir) const
+    {
+        return m_entry_refs[static_cast<std::size_t>(dir)][pos.first * m_dims.second + pos.second];
+    }
+};
+
+/**
+ * An iterator that produces the candidate sequences of
+ * OrdinalWrappingSequenceIter as views into precomputed OrdinalWrappingLines
+ * instead of copies.
+ *
+ * For each entry (top-to-bottom, then left-to-right) and each direction, the
+ * sequences of length 1 up to the length of the line through the entry are
+ * produced in turn. This walks the same (entry, direction, length) order as
+ * OrdinalWrappingSequenceIter, except for the single-letter sequences:
+ * OrdinalWrappingSequenceIter starts every direction at length 2 and only
+ * produces a single letter once, for the first entry of the grid, whereas this
+ * iterator produces a length-1 view for every (entry, direction). Callers that
+ * count or collect sequences will see those extra views. Advancing the
+ * iterator only adjusts a view, so no letters are copied.
+ *
+ * This iterator is an input iterator. The produced views remain valid for as
+ * long as the underlying lines do.
+ */
+class OrdinalSequenceViewIter {
+  public:
+    /*
+     * Standard aliases for iterator traits [1].
+     */
+    using value_type = std::string_view;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::input_iterator_tag;
+
+    /// Type used to access entries of the grid.
+    using Coordinate = OrdinalWrappingLines::Coordinate;
+
+  private:
+    /// The lines being iterated over. This pointer will be null in the end sentinel.
+    const OrdinalWrappingLines* m_lines{nullptr};
+
+    /// The position of the first letter of the current sequence.
+    Coordinate m_center{};
+
+    /// The direction in which the current sequence extends.
+    OrdinalDirection m_dir{OrdinalDirection::N};
+
+    /// The length of the longest sequence from the current center and direction.
+    std::size_t m_max_length{0};
+
+    /// The current sequence.
+    std::string_view m_view{};
+
+  public:
+    /// Creates an end iterator.
+    OrdinalSequenceViewIter() noexcept = default;
+
+    /**
+     * Creates an iterator over the given lines, starting with the sequences
+     * whose first letter is at the given entry.
+     */
+    explicit OrdinalSequenceViewIter(const OrdinalWrappingLines& lines, Coordinate first_center = {0, 0})
+        : m_lines(&lines), m_center(first_center)
+    {
+        const auto[rows, cols] = m_lines->dimensions();
+        if (rows == 0 || cols == 0 || m_center.second >= cols) {
+            // If the grid is empty, make this iterator an end sentinel.
+            m_lines = nullptr;
+        } else {
+            start_direction();
+        }
+    }
+
+    // Dereference operator overload.
+    reference operator*() const { return m_view; }
+
+    // Arrow operator overload.
+    pointer operator->() const { return &m_view; }
+
+    // Equality operator overload.
+    bool operator==(const OrdinalSequenceViewIter& rhs) const
+    {
+        if (!m_lines || !rhs.m_lines) {
+            return m_lines == rhs.m_lines;
+        }
+        return m_center == rhs.m_center && m_dir == rhs.m_dir && m_view.size() == rhs.m_view.size();
+    }
+
+    bool operator!=(const OrdinalSequenceViewIter& rhs) const
+    {
+        return !(rhs == *this);
+    }
+
+    // Pre-increment operator overload.
+    OrdinalSequenceViewIter& operator++()
+    {
+        if (m_view.size() < m_max_length) {
+            m_view = std::string_view(m_view.data(), m_view.size() + 1);
+        } else {
+            skip_direction();
+        }
+        return *this;
+    }
+
+    // Post-increment operator overload.
+    OrdinalSequenceViewIter operator++(int) {
+        auto temp = *this;
+        ++*this;
+        return temp;
+    }
+
+    /**
+     * Abandons the remaining sequences in the current direction and moves
+     * this iterator to the first sequence of the next direction.
+     */
+    void skip_direction()
+    {
+        if (m_dir != OrdinalDirection::NW) {
+            m_dir = static_cast<OrdinalDirection>(static_cast<int>(m_dir) + 1);
+        } else {
+            m_dir = OrdinalDirection::N;
+            const auto[rows, cols] = m_lines->dimensions();
+            m_center.first += 1;
+            if (m_center.first == rows) {
+                m_center.first = 0;
+                m_center.second += 1;
+            }
+            if (m_center.second == cols) {
+                m_lines = nullptr;
+                return;
+            }
+        }
+        start_direction();
+    }
+
+    /// Returns the position of the first element of the current sequence.
+    [[nodiscard]] Coordinate center() const noexcept { return m_center; }
+
+    /// Returns the direction along which the current sequence extends.
+    [[nodiscard]] OrdinalDirection direction() const noexcept { return m_dir; }
+
+  private:
+    /// Produces the single-letter sequence for the current center and direction.
+    void start_direction()
+    {
+        m_max_length = m_lines->line_length(m_center, m_dir);
+        m_view = m_lines->sequence(m_center, m_dir, 1);
+    }
+};
+
+#endif //EECE_2560_PROJECTS_ORDINAL_WRAPPING_LINES_H
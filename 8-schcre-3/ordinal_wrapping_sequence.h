@@ -13,6 +13,9 @@
 #ifndef EECE_2560_PROJECTS_ORDINAL_WRAPPING_SEQUENCE_H
 #define EECE_2560_PROJECTS_ORDINAL_WRAPPING_SEQUENCE_H
 
+#include <array>                // for std::array
+#include <ostream>              // for std::ostream
+#include <utility>              // for std::pair
 #include <vector>               // for std::vector
 
 #include "matrix.h"
@@ -26,6 +29,64 @@ constexpr T positive_mod(T value, T base)
 }
 } // end namespace details
 
+/// The eight ordinal directions along which word search sequences are produced.
+enum class OrdinalDirection { N, NE, E, SE, S, SW, W, NW };
+
+/// All ordinal directions, in the order visited by the sequence iterators.
+constexpr std::array<OrdinalDirection, 8> k_ordinal_directions{
+    OrdinalDirection::N, OrdinalDirection::NE, OrdinalDirection::E, OrdinalDirection::SE,
+    OrdinalDirection::S, OrdinalDirection::SW, OrdinalDirection::W, OrdinalDirection::NW
+};
+
+/// Returns the (row, column) coordinate offset corresponding to the given direction.
+constexpr std::pair<int, int> ordinal_offset(OrdinalDirection dir)
+{
+    switch (dir) {
+        case OrdinalDirection::N: return {-1, 0};
+        case OrdinalDirection::NE: return {-1, 1};
+        case OrdinalDirection::E: return {0, 1};
+        case OrdinalDirection::SE: return {1, 1};
+        case OrdinalDirection::S: return {1, 0};
+        case OrdinalDirection::SW: return {1, -1};
+        case OrdinalDirection::W: return {0, -1};
+        case OrdinalDirection::NW: return {-1, -1};
+    }
+    // Signal to GCC that reaching the end of this function is impossible,
+    // since the version of GCC we're using emits a warning despite the above
+    // switch being exhaustive.
+    __builtin_unreachable();
+}
+
+/**
+ * Returns the position one step away from `pos` in the given direction on a
+ * grid with the given dimensions, wrapping around the edges of the grid.
+ *
+ * Repeatedly stepping in a fixed direction eventually returns to the starting
+ * position, so the positions visited form a cycle.
+ */
+template<typename Coordinate>
+constexpr Coordinate wrapping_step(Coordinate pos, OrdinalDirection dir, Coordinate dims)
+{
+    const auto[rows, cols] = dims;
+    const auto offset = ordinal_offset(dir);
+    return {
+        static_cast<typename Coordinate::first_type>(
+            details::positive_mod(static_cast<int>(pos.first) + offset.first, static_cast<int>(rows))
+        ),
+        static_cast<typename Coordinate::second_type>(
+            details::positive_mod(static_cast<int>(pos.second) + offset.second, static_cast<int>(cols))
+        )
+    };
+}
+
+/// Output stream operator overload for ordinal directions.
+inline std::ostream& operator<<(std::ostream& out, OrdinalDirection dir)
+{
+    constexpr const char* names[]{"N", "NE", "E", "SE", "S", "SW", "W", "NW"};
+    out << names[static_cast<int>(dir)];
+    return out;
+}
+
 /**
  * An iterator that produces every consecutive sequence of elements produced
  * by traversing a matrix along each of the eight ordinal directions, starting
@@ -46,12 +107,12 @@ class OrdinalWrappingSequenceIter {
     using difference_type = std::ptrdiff_t;
     using iterator_category = std::input_iterator_tag;
 
-  private:
     /// Type used to access elements of the underlying matrix.
     using Coordinate = typename Matrix<T>::Coordinate;
 
+  private:
     /// The current direction of iteration for producing sequence elements.
-    enum { N, NE, E, SE, S, SW, W, NW } m_dir{N};
+    OrdinalDirection m_dir{OrdinalDirection::N};
 
     /// The matrix being iterated over. This pointer will be null in the end sentinel.
     const Matrix<T>* m_grid_ref;
@@ -116,22 +177,34 @@ class OrdinalWrappingSequenceIter {
     {
         advance();
         if (m_curr_pos == m_curr_center) {
-            m_sequence.clear();
-            change_dir();
-
-            if (m_grid_ref) {
-                m_sequence.push_back((*m_grid_ref)[m_curr_pos]);
-                advance();
-            } else {
-                // Return prematurely before the candidate is updated again.
-                return *this;
-            }
+            // The sequence has wrapped back around to its starting element.
+            start_next_direction();
+        } else {
+            m_sequence.push_back((*m_grid_ref)[m_curr_pos]);
         }
-        m_sequence.push_back((*m_grid_ref)[m_curr_pos]);
-
         return *this;
     }
 
+    /**
+     * Abandons the remaining sequences in the current direction and moves
+     * this iterator to the first sequence of the next direction, as if the
+     * current direction had been exhausted.
+     *
+     * This allows callers to prune directions once they know no longer
+     * sequence can be of interest (e.g. no word begins with the current one).
+     */
+    void skip_direction()
+    {
+        m_curr_pos = m_curr_center;
+        start_next_direction();
+    }
+
+    /// Returns the position of the first element of the current sequence.
+    [[nodiscard]] Coordinate center() const noexcept { return m_curr_center; }
+
+    /// Returns the direction along which the current sequence extends.
+    [[nodiscard]] OrdinalDirection direction() const noexcept { return m_dir; }
+
     // Post-increment operator overload.
     OrdinalWrappingSequenceIter operator++(int) {
         auto temp = *this;
@@ -141,72 +214,63 @@ class OrdinalWrappingSequenceIter {
 
   private:
 
-    /// Increase the length of this iterators sequence by one in the current direction.
-    void advance()
+    /**
+     * Rotates this iterator to the next direction (and center, if needed) and
+     * produces the first sequence in that direction. Makes this iterator an
+     * end sentinel if no directions remain.
+     */
+    void start_next_direction()
     {
-        const auto[rows, cols] = m_grid_ref->dimensions();
-        auto offset = compute_offset();
+        m_sequence.clear();
+        change_dir();
 
-        Coordinate next {
-            details::positive_mod(static_cast<int>(m_curr_pos.first) + offset.first, static_cast<int>(cols)),
-            details::positive_mod(static_cast<int>(m_curr_pos.second) + offset.second, static_cast<int>(rows))
-        };
+        if (m_grid_ref) {
+            m_sequence.push_back((*m_grid_ref)[m_curr_pos]);
+            advance();
+            m_sequence.push_back((*m_grid_ref)[m_curr_pos]);
+        }
+    }
 
-        m_curr_pos = next;
+    /// Increase the length of this iterators sequence by one in the current direction.
+    void advance()
+    {
+        m_curr_pos = wrapping_step(m_curr_pos, m_dir, m_grid_ref->dimensions());
     }
 
     /// Rotates the direction of this iterator. Updates the "center" position
     /// if this iterator has completed a full rotation.
     void change_dir()
     {
+        using Dir = OrdinalDirection;
         switch (m_dir) {
-            case N: { m_dir = NE; break;}
-            case NE:{ m_dir = E; break; }
-            case E: { m_dir = SE; break; }
-            case SE:{ m_dir = S; break; }
-            case S: { m_dir = SW; break; }
-            case SW:{ m_dir = W; break; }
-            case W:{ m_dir = NW; break; }
-            case NW: {
-                m_dir = N;
+            case Dir::N: { m_dir = Dir::NE; break;}
+            case Dir::NE:{ m_dir = Dir::E; break; }
+            case Dir::E: { m_dir = Dir::SE; break; }
+            case Dir::SE:{ m_dir = Dir::S; break; }
+            case Dir::S: { m_dir = Dir::SW; break; }
+            case Dir::SW:{ m_dir = Dir::W; break; }
+            case Dir::W:{ m_dir = Dir::NW; break; }
+            case Dir::NW: {
+                m_dir = Dir::N;
                 advance_center();
             };
         }
     }
 
-    /// Updates the center position of this iterator, proceeding left-to-right,
-    /// top-to-bottom.
+    /// Updates the center position of this iterator, proceeding top-to-bottom,
+    /// left-to-right.
     void advance_center() {
         const auto[rows, cols] = m_grid_ref->dimensions();
         m_curr_center.first += 1;
-        if (m_curr_center.first == cols) {
+        if (m_curr_center.first == rows) {
             m_curr_center.first = 0;
             m_curr_center.second += 1;
         }
-        if (m_curr_center.second == rows) {
+        if (m_curr_center.second == cols) {
             m_grid_ref = nullptr;
         }
         m_curr_pos = m_curr_center;
     }
-
-    /// Returns the coordinate offset corresponding to this iterator's current direction.
-    [[nodiscard]] std::pair<int, int> compute_offset() const
-    {
-        switch (m_dir) {
-            case N: return {-1, 0};
-            case NE: return {-1, 1};
-            case E: return {0, 1};
-            case SE: return {1, 1};
-            case S: return {1, 0};
-            case SW: return {1, -1};
-            case W: return {0, -1};
-            case NW: return {-1, -1};
-        }
-        // Signal to GCC that reaching the end of this function is impossible,
-        // since the version of GCC we're using emits a warning despite the above
-        // switch being exhaustive.
-        __builtin_unreachable();
-    }
 };
 
 #endif //EECE_2560_PROJECTS_ORDINAL_WRAPPING_SEQUENCE_H
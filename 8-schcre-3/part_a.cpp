@@ -7,12 +7,16 @@
  *
  */
 
+#include <cstdlib>              // for EXIT_FAILURE
+#include <filesystem>           // for std::filesystem::exists
 #include <iostream>             // for I/O stream definitions
+#include <stdexcept>            // for std::runtime_error
+#include <vector>               // for std::vector
 
-#include "algo_util.h"
 #include "eece2560_io.h"
-#include "eece2560_iter.h"
 #include "dictionary.h"
+#include "dictionary_trie.h"
+#include "mapped_dictionary.h"
 #include "word_search_grid.h"
 
 /// The minimum length of valid words in the word search grid.
@@ -20,34 +24,45 @@ constexpr std::size_t MIN_WORD_LENGTH{5};
 
 constexpr const char* DICTIONARY_FILE = "resources/dictionary.txt";
 
+/// Compiled dictionary written by the dictionary compiler.
+constexpr const char* COMPILED_DICTIONARY_FILE = "resources/dictionary.bin";
+
 /**
- * Prints all words contained in the given dictionary that appear in the given
- * word search grid.
+ * Returns all words of at least MIN_WORD_LENGTH letters in the dictionary
+ * that appear in the given word search grid.
+ *
+ * If the compiled dictionary exists, it is searched directly through its
+ * memory mapping, since it is already normalized and sorted. Otherwise the
+ * plain text dictionary is read and indexed by a trie. In both cases the
+ * search abandons a direction as soon as no word begins with the current
+ * sequence.
+ *
+ * A compiled dictionary that exists but cannot be opened is reported by the
+ * std::runtime_error thrown by MappedDictionary rather than silently ignored.
  *
- * @param dictionary Dictionary of valid words.
  * @param grid Word search grid.
  */
-void print_matches(const Dictionary& dictionary, const WordSearchGrid& grid)
+std::vector<WordMatch> find_matches(const WordSearchGrid& grid)
 {
-    constexpr static auto filter_words = [](auto word) {
-        return word.size() >= MIN_WORD_LENGTH;
-    };
-
-    eece2560::FilterIter start(std::begin(grid), std::end(grid), filter_words);
-    eece2560::FilterIter end(std::end(grid), std::end(grid), filter_words);
-
-    std::size_t found_count{0};
-
-    while (start != end) {
-        std::string_view key{start->data(), start->size()};
+    if (std::filesystem::exists(COMPILED_DICTIONARY_FILE)) {
+        const MappedDictionary dictionary(COMPILED_DICTIONARY_FILE);
+        return grid.find_words(dictionary, MIN_WORD_LENGTH);
+    }
+    const DictionaryTrie trie(Dictionary::read_file(DICTIONARY_FILE));
+    return grid.find_words(trie, MIN_WORD_LENGTH);
+}
 
-        if (dictionary.contains(key)) {
-            ++found_count;
-            std::cout << "Found: " << key << '\n';
-        }
-        ++start;
+/**
+ * Prints all words in the given list of matches.
+ *
+ * @param matches Words found in a word search grid.
+ */
+void print_matches(const std::vector<WordMatch>& matches)
+{
+    for (const auto& match : matches) {
+        std::cout << "Found: " << match.word << '\n';
     }
-    std::cout << "\nFound " << found_count << " words.\n";
+    std::cout << "\nFound " << matches.size() << " words.\n";
 
 }
 
@@ -57,17 +72,19 @@ void print_matches(const Dictionary& dictionary, const WordSearchGrid& grid)
  */
 void run_word_search()
 {
-    const auto dictionary = Dictionary::read_file(DICTIONARY_FILE);
-//    std::cout << "Dictionary: " << dictionary << '\n';
-
     const auto word_search_file = eece2560::prompt_user<std::string>("Enter the word search file name: ");
 
     const auto grid = WordSearchGrid::read_file(word_search_file.c_str());
 
-    print_matches(dictionary, grid);
+    print_matches(find_matches(grid));
 }
 
 int main()
 {
-    run_word_search();
+    try {
+        run_word_search();
+    } catch (const std::runtime_error& error) {
+        std::cerr << "error: " << error.what() << '\n';
+        return EXIT_FAILURE;
+    }
 }
@@ -8,11 +8,16 @@
  */
 
 #include <iostream>             // for I/O stream definitions
+#include <optional>             // for std::optional
+#include <stdexcept>            // for std::runtime_error
+#include <vector>               // for std::vector
 
-#include "algo_util.h"
 #include "eece2560_io.h"
-#include "eece2560_iter.h"
+#include "eece2560_thread_pool.h"
 #include "dictionary.h"
+#include "aho_corasick.h"
+#include "dictionary_trie.h"
+#include "hash_dictionary.h"
 #include "word_search_grid.h"
 
 /// The minimum length of valid words in the word search grid.
@@ -20,61 +25,124 @@ constexpr std::size_t MIN_WORD_LENGTH{5};
 
 constexpr const char* DICTIONARY_FILE = "resources/dictionary.txt";
 
+/// Prebuilt hash dictionary written by the dictionary compiler.
+constexpr const char* HASH_DICTIONARY_FILE = "resources/dictionary.hash";
+
+/// Loads the prebuilt hash dictionary, or returns nothing if it is missing or invalid.
+std::optional<HashDictionary> load_hash_dictionary()
+{
+    try {
+        return HashDictionary::load_file(HASH_DICTIONARY_FILE);
+    } catch (const std::runtime_error&) {
+        return std::nullopt;
+    }
+}
+
 /**
- * Prints all words contained in the given dictionary that appear in the given
+ * Finds all words contained in the given dictionary that appear in the given
  * word search grid.
  *
  * @param dictionary Dictionary of valid words.
  * @param grid Word search grid.
+ * @param mode Strategy used to locate the words.
  */
-void print_matches(const Dictionary& dictionary, const WordSearchGrid& grid)
+std::vector<WordMatch> find_matches(const Dictionary& dictionary, const WordSearchGrid& grid, SearchMode mode)
 {
-    constexpr static auto filter_words = [](auto word) {
-        return word.size() >= MIN_WORD_LENGTH;
-    };
-
-    eece2560::FilterIter start(std::begin(grid), std::end(grid), filter_words);
-    eece2560::FilterIter end(std::end(grid), std::end(grid), filter_words);
+    std::vector<WordMatch> matches;
+    switch (mode) {
+        case SearchMode::TrieWalk: {
+            // Index the dictionary by prefix so that the search can abandon a
+            // direction as soon as no word begins with the current sequence.
+            const DictionaryTrie trie(dictionary);
+            matches = grid.find_words(trie, MIN_WORD_LENGTH);
+            break;
+        }
+        case SearchMode::AhoCorasick: {
+            // Match the whole dictionary in one pass over each grid line.
+            const AhoCorasickAutomaton automaton(dictionary);
+            matches = grid.find_words(automaton, MIN_WORD_LENGTH);
+            break;
+        }
+        case SearchMode::ParallelTrieWalk: {
+            // Split the trie walk across all hardware threads.
+            const DictionaryTrie trie(dictionary);
+            eece2560::ThreadPool pool;
+            matches = grid.find_words(trie, MIN_WORD_LENGTH, pool);
+            break;
+        }
+        case SearchMode::HashLookup: {
+            // No prebuilt hash dictionary was available, so build one.
+            matches = grid.find_words(HashDictionary(dictionary), MIN_WORD_LENGTH);
+            break;
+        }
+        case SearchMode::SortedLookup: {
+            // Look up every sequence in the sorted dictionary's own index.
+            matches = grid.find_words(dictionary, MIN_WORD_LENGTH);
+            break;
+        }
+    }
+    return matches;
+}
 
-    std::size_t found_count{0};
+/// Prints the given word matches followed by their count.
+void print_matches(const std::vector<WordMatch>& matches)
+{
+    for (const auto& match : matches) {
+        std::cout << "Found: " << match.word << " at (" << match.start.first << ", " << match.start.second
+                  << ") heading " << match.direction << '\n';
+    }
+    std::cout << "\nFound " << matches.size() << " words.\n";
 
-    while (start != end) {
-        std::string_view key{start->data(), start->size()};
+}
 
-        if (dictionary.contains(key)) {
-            ++found_count;
-            std::cout << "Found: " << key << '\n';
-        }
-        ++start;
-    }
-    std::cout << "\nFound " << found_count << " words.\n";
+/// Prompts the user for a file containing a word search and reads it.
+WordSearchGrid prompt_word_search()
+{
+    const auto word_search_file = eece2560::prompt_user<std::string>(
+        "Enter the word search file name (e.g. \"resources/15x15.txt\"): "
+    );
 
+    return WordSearchGrid::read_file(word_search_file.c_str());
 }
 
 /**
  * Prompts the user for a file containing a word search and prints all words
  * contained in word search.
  */
-void run_word_search(Dictionary::SortingAlgorithm algorithm)
+void run_word_search(Dictionary::SortingAlgorithm algorithm, SearchMode mode)
 {
     std::cout << "Preparing the dictionary . . . " << std::flush;
-    const auto dictionary = Dictionary::read_file(DICTIONARY_FILE, algorithm);
-    std::cout << "DONE\nDictionary: " << dictionary << '\n';
 
-    const auto word_search_file = eece2560::prompt_user<std::string>(
-        "Enter the word search file name (e.g. \"resources/15x15.txt\"): "
-    );
+    // A prebuilt hash dictionary replaces the text dictionary entirely, so it
+    // is tried before the text dictionary is read and sorted.
+    if (mode == SearchMode::HashLookup) {
+        if (const auto hash_dictionary = load_hash_dictionary()) {
+            std::cout << "DONE\nDictionary: " << hash_dictionary->size() << " words from "
+                      << HASH_DICTIONARY_FILE << '\n';
+            const auto grid = prompt_word_search();
+            print_matches(grid.find_words(*hash_dictionary, MIN_WORD_LENGTH));
+            return;
+        }
+    }
 
-    const auto grid = WordSearchGrid::read_file(word_search_file.c_str());
+    const auto dictionary = Dictionary::read_file(DICTIONARY_FILE, algorithm);
+    std::cout << "DONE\nDictionary: " << dictionary << '\n';
 
-    print_matches(dictionary, grid);
+    const auto grid = prompt_word_search();
+    print_matches(find_matches(dictionary, grid, mode));
 }
 
 int main()
 {
     auto sorting_algorithm = eece2560::prompt_user<Dictionary::SortingAlgorithm>(
-        "Pick the dictionary sorting algorithm (0 for selection sort, 1 for quick sort, 2 for heap sort): "
+        "Pick the dictionary sorting algorithm (0 for selection sort, 1 for quick sort, 2 for heap sort, "
+        "3 for parallel sort, 4 for radix sort): "
     );
     std::cout << "Using " << sorting_algorithm << '\n';
-    run_word_search(sorting_algorithm);
+    auto search_mode = eece2560::prompt_user<SearchMode>(
+        "Pick the search mode (0 for trie walk, 1 for Aho-Corasick, 2 for parallel trie walk, 3 for hash lookup, "
+        "4 for sorted lookup): "
+    );
+    std::cout << "Using " << search_mode << '\n';
+    run_word_search(sorting_algorithm, search_mode);
 }
@@ -0,0 +1,122 @@
+/**
+ * Test executable for Project 3.
+ *
+ * Checks that OwningHeap returns its entries in descending order from pop(),
+ * sorts them in ascending order, and remains a valid heap after sort() for
+ * both binary and d-ary heaps.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "heap.h"
+
+// Using anonymous namespace to give symbols internal linkage.
+namespace {
+
+template<std::size_t Arity>
+using Heap = OwningHeap<std::vector<int>, std::less<>, Arity>;
+
+/// Reports the outcome of a single test case and returns whether it passed.
+bool report(const char* name, bool passed)
+{
+    std::cout << "Case " << name << (passed ? " OK\n" : " FAILED\n");
+    return passed;
+}
+
+/// Returns a fixed pseudo-random list of values with repeats.
+std::vector<int> shuffled_values()
+{
+    std::vector<int> values;
+    for (int i{0}; i < 500; ++i) {
+        values.push_back(i % 97);
+    }
+    std::shuffle(values.begin(), values.end(), std::mt19937{2560});
+    return values;
+}
+
+/// Pops every entry of the given heap and returns them in the order popped.
+template<std::size_t Arity>
+std::vector<int> drain(Heap<Arity>& heap)
+{
+    std::vector<int> popped;
+    while (!heap.empty()) {
+        popped.push_back(heap.pop());
+    }
+    return popped;
+}
+
+/// Checks that pushed values are popped in descending order.
+template<std::size_t Arity>
+bool test_push_pop_order()
+{
+    auto values = shuffled_values();
+    Heap<Arity> heap;
+    for (auto value : values) {
+        heap.push(value);
+        const auto pushed_end = values.begin() + static_cast<std::ptrdiff_t>(heap.size());
+        if (heap.top() != *std::max_element(values.begin(), pushed_end)) {
+            return false;
+        }
+    }
+
+    std::sort(values.begin(), values.end(), std::greater<>());
+    return drain(heap) == values;
+}
+
+/// Checks that sort() leaves the entries in ascending order, including when
+/// it is called again on entries that are already sorted.
+template<std::size_t Arity>
+bool test_sort_twice()
+{
+    auto values = shuffled_values();
+    Heap<Arity> heap(values);
+    std::sort(values.begin(), values.end());
+
+    heap.sort();
+    if (!std::equal(heap.begin(), heap.end(), values.begin(), values.end())) {
+        return false;
+    }
+    heap.sort();
+    return std::equal(heap.begin(), heap.end(), values.begin(), values.end());
+}
+
+/// Checks that the heap can be used again after sort().
+template<std::size_t Arity>
+bool test_push_after_sort()
+{
+    auto values = shuffled_values();
+    Heap<Arity> heap(values);
+
+    heap.sort();
+    if (heap.top() != 96) {
+        return false;
+    }
+    heap.push(50);
+    heap.push(200);
+    values.push_back(50);
+    values.push_back(200);
+
+    std::sort(values.begin(), values.end(), std::greater<>());
+    return drain(heap) == values;
+}
+
+} // end namespace
+
+int main()
+{
+    bool passed{true};
+    passed &= report("binary push/pop order", test_push_pop_order<2>());
+    passed &= report("4-ary push/pop order", test_push_pop_order<4>());
+    passed &= report("binary sort twice", test_sort_twice<2>());
+    passed &= report("4-ary sort twice", test_sort_twice<4>());
+    passed &= report("binary push after sort", test_push_after_sort<2>());
+    passed &= report("4-ary push after sort", test_push_after_sort<4>());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
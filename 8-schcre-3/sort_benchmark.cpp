@@ -0,0 +1,340 @@
+/**
+ * Project 3 sorting benchmarks.
+ *
+ * Runs every Dictionary::SortingAlgorithm, plus std::sort as a baseline, on
+ * random, sorted, reverse-sorted and duplicate-heavy lists of strings with
+ * sizes from one thousand to ten million. Results are written to the standard
+ * output as CSV with one row per (algorithm, input, size).
+ *
+ * Each case is measured twice. The first pass sorts plain std::strings and
+ * reports the wall time per sort. The second pass sorts CountedStrings, which
+ * count the element comparisons, swaps and moves performed by the algorithm.
+ * Keeping the counting out of the timed pass stops the atomic counters from
+ * skewing the timings. Radix sort inspects characters rather than comparing
+ * elements, so it reports few or no element comparisons.
+ *
+ * Selection sort, and the first-element pivot quicksort on inputs that are
+ * already ordered or full of duplicates, take quadratic time. They are only
+ * run up to a size cap; larger cases are skipped.
+ *
+ * Usage: 8-schcre-3-sort-bench [max_size]
+ *
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful timings.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://en.cppreference.com/w/cpp/algorithm/iter_swap
+ *  [2] https://en.cppreference.com/w/cpp/atomic/memory_order
+ *  [3] https://en.cppreference.com/w/cpp/chrono/steady_clock
+ */
+
+#include <algorithm>        // for std::sort, std::is_sorted, std::reverse
+#include <array>            // for std::array
+#include <atomic>           // for std::atomic
+#include <chrono>           // for std::chrono::steady_clock
+#include <cstdint>          // for std::uint64_t
+#include <cstdlib>          // for std::strtoull, EXIT_FAILURE
+#include <iostream>         // for I/O definitions
+#include <optional>         // for std::optional
+#include <random>           // for std::mt19937_64
+#include <sstream>          // for std::ostringstream
+#include <string>           // for std::string
+#include <string_view>      // for std::string_view
+#include <utility>          // for std::move
+#include <vector>           // for std::vector
+
+#include "dictionary.h"
+
+namespace {
+
+using SortingAlgorithm = Dictionary::SortingAlgorithm;
+
+/// List sizes to benchmark, from one thousand to ten million strings.
+constexpr std::array<std::size_t, 5> k_sizes{1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+
+/// Each timed sort is repeated until roughly this many elements have been sorted...
+constexpr std::size_t k_min_elements_per_case{1'000'000};
+
+/// ...or until this much time has been measured, whichever comes first.
+constexpr std::uint64_t k_max_ns_per_case{500'000'000};
+
+/// Largest list given to an algorithm while it runs in quadratic time.
+constexpr std::size_t k_quadratic_limit{10'000};
+
+/// Largest duplicate-heavy list given to the first-element pivot quicksort,
+/// which is quadratic within each run of equal strings.
+constexpr std::size_t k_quicksort_duplicate_limit{100'000};
+
+/// The number of distinct strings in duplicate-heavy inputs.
+constexpr std::size_t k_distinct_duplicates{100};
+
+/// Fixed PRNG seed so that every algorithm sorts the same inputs.
+constexpr std::mt19937_64::result_type k_seed{2560};
+
+/// The algorithms benchmarked. std::nullopt stands for the std::sort baseline.
+constexpr std::array<std::optional<SortingAlgorithm>, 6> k_algorithms{
+    SortingAlgorithm::SelectionSort, SortingAlgorithm::QuickSort, SortingAlgorithm::HeapSort,
+    SortingAlgorithm::ParallelSort, SortingAlgorithm::RadixSort, std::nullopt
+};
+
+/// The orderings of the benchmark inputs.
+enum class InputKind { Random, Sorted, Reversed, Duplicates };
+
+constexpr std::array k_input_kinds{InputKind::Random, InputKind::Sorted, InputKind::Reversed, InputKind::Duplicates};
+
+std::string_view input_name(InputKind kind)
+{
+    switch (kind) {
+        case InputKind::Random: return "random";
+        case InputKind::Sorted: return "sorted";
+        case InputKind::Reversed: return "reversed";
+        case InputKind::Duplicates: return "duplicates";
+    }
+    // Signal to GCC that reaching the end of this function is impossible.
+    __builtin_unreachable();
+}
+
+/// Returns the name of the given algorithm, as printed in the CSV output.
+std::string algorithm_name(std::optional<SortingAlgorithm> algorithm)
+{
+    if (!algorithm) {
+        return "StdSort";
+    }
+    std::ostringstream out;
+    out << *algorithm;
+    return out.str();
+}
+
+/// Operation counts, shared by every CountedString. The counters may be
+/// incremented by several threads at once during a parallel sort.
+struct OperationCounts {
+    std::atomic<std::uint64_t> comparisons{0};
+    std::atomic<std::uint64_t> swaps{0};
+    std::atomic<std::uint64_t> moves{0};
+
+    void reset()
+    {
+        comparisons = 0;
+        swaps = 0;
+        moves = 0;
+    }
+};
+
+OperationCounts g_counts;
+
+/// Increments the given counter. Only the total matters, so no ordering is
+/// needed between threads [2].
+void count(std::atomic<std::uint64_t>& counter)
+{
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * A string that records every comparison, swap and move made on it in
+ * g_counts.
+ *
+ * std::iter_swap swaps elements through an unqualified call to swap [1], so
+ * the swap() overload below is found by argument dependent lookup and every
+ * swap made by the sorting algorithms is counted once, rather than as three
+ * moves.
+ */
+class CountedString {
+    std::string m_value;
+
+  public:
+    CountedString() = default;
+
+    explicit CountedString(std::string value) : m_value(std::move(value)) {}
+
+    CountedString(const CountedString& other) : m_value(other.m_value) { count(g_counts.moves); }
+
+    CountedString(CountedString&& other) noexcept : m_value(std::move(other.m_value)) { count(g_counts.moves); }
+
+    CountedString& operator=(const CountedString& other)
+    {
+        count(g_counts.moves);
+        m_value = other.m_value;
+        return *this;
+    }
+
+    CountedString& operator=(CountedString&& other) noexcept
+    {
+        count(g_counts.moves);
+        m_value = std::move(other.m_value);
+        return *this;
+    }
+
+    ~CountedString() = default;
+
+    /// Conversion used by the radix sort to inspect characters.
+    operator std::string_view() const noexcept { return m_value; }
+
+    friend bool operator<(const CountedString& lhs, const CountedString& rhs)
+    {
+        count(g_counts.comparisons);
+        return lhs.m_value < rhs.m_value;
+    }
+
+    friend void swap(CountedString& lhs, CountedString& rhs) noexcept
+    {
+        count(g_counts.swaps);
+        lhs.m_value.swap(rhs.m_value);
+    }
+};
+
+/// Sorts the given range with the given algorithm through Dictionary, or
+/// with std::sort if no algorithm is given.
+template<typename Iter>
+void run_sort(std::optional<SortingAlgorithm> algorithm, Iter first, Iter last)
+{
+    if (algorithm) {
+        Dictionary::sort_range(*algorithm, first, last);
+    } else {
+        std::sort(first, last);
+    }
+}
+
+/// Returns true if the given algorithm runs in reasonable time on the given input.
+bool is_feasible(std::optional<SortingAlgorithm> algorithm, InputKind kind, std::size_t size)
+{
+    if (algorithm == SortingAlgorithm::SelectionSort) {
+        return size <= k_quadratic_limit;
+    }
+    if (algorithm == SortingAlgorithm::QuickSort) {
+        switch (kind) {
+            case InputKind::Random: return true;
+            case InputKind::Sorted:
+            case InputKind::Reversed: return size <= k_quadratic_limit;
+            case InputKind::Duplicates: return size <= k_quicksort_duplicate_limit;
+        }
+    }
+    return true;
+}
+
+/// Returns a random lowercase string with between 4 and 12 letters.
+std::string random_word(std::mt19937_64& rng)
+{
+    std::uniform_int_distribution<std::size_t> length_dist(4, 12);
+    std::uniform_int_distribution<int> letter_dist('a', 'z');
+
+    std::string word(length_dist(rng), '\0');
+    for (auto& letter : word) {
+        letter = static_cast<char>(letter_dist(rng));
+    }
+    return word;
+}
+
+/// Builds a benchmark input with the given ordering and size.
+std::vector<std::string> make_input(InputKind kind, std::size_t size)
+{
+    std::mt19937_64 rng(k_seed);
+    std::vector<std::string> words;
+    words.reserve(size);
+
+    if (kind == InputKind::Duplicates) {
+        std::vector<std::string> distinct;
+        for (std::size_t i{0}; i < k_distinct_duplicates; ++i) {
+            distinct.push_back(random_word(rng));
+        }
+        std::uniform_int_distribution<std::size_t> pick(0, distinct.size() - 1);
+        for (std::size_t i{0}; i < size; ++i) {
+            words.push_back(distinct[pick(rng)]);
+        }
+        return words;
+    }
+
+    for (std::size_t i{0}; i < size; ++i) {
+        words.push_back(random_word(rng));
+    }
+    if (kind == InputKind::Sorted || kind == InputKind::Reversed) {
+        std::sort(std::begin(words), std::end(words));
+    }
+    if (kind == InputKind::Reversed) {
+        std::reverse(std::begin(words), std::end(words));
+    }
+    return words;
+}
+
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t elapsed_ns(Clock::time_point start)
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()
+    );
+}
+
+/// Stops the benchmark if the given range was not sorted correctly.
+template<typename Iter>
+void check_sorted(Iter first, Iter last, std::optional<SortingAlgorithm> algorithm)
+{
+    if (!std::is_sorted(first, last)) {
+        std::cerr << algorithm_name(algorithm) << " produced an unsorted result\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+/// Benchmarks one algorithm on one input and prints its CSV row.
+void run_case(std::optional<SortingAlgorithm> algorithm, InputKind kind, const std::vector<std::string>& input)
+{
+    // Timed pass: repeat the sort on fresh copies of the input. Only the sort
+    // itself is timed.
+    const std::size_t repetitions = std::max<std::size_t>(1, k_min_elements_per_case / input.size());
+    std::size_t completed{0};
+    std::uint64_t total_ns{0};
+    for (; completed < repetitions && total_ns < k_max_ns_per_case; ++completed) {
+        auto words = input;
+        const auto start = Clock::now();
+        run_sort(algorithm, std::begin(words), std::end(words));
+        total_ns += elapsed_ns(start);
+        check_sorted(std::cbegin(words), std::cend(words), algorithm);
+    }
+
+    // Counting pass.
+    std::vector<CountedString> counted;
+    counted.reserve(input.size());
+    for (const auto& word : input) {
+        counted.emplace_back(word);
+    }
+    g_counts.reset();
+    run_sort(algorithm, std::begin(counted), std::end(counted));
+    const std::uint64_t comparisons = g_counts.comparisons;
+    const std::uint64_t swaps = g_counts.swaps;
+    const std::uint64_t moves = g_counts.moves;
+    check_sorted(std::cbegin(counted), std::cend(counted), algorithm);
+
+    std::cout << algorithm_name(algorithm) << ',' << input_name(kind) << ',' << input.size() << ','
+              << completed << ',' << static_cast<double>(total_ns) / static_cast<double>(completed) << ','
+              << comparisons << ',' << swaps << ',' << moves << '\n';
+}
+
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t max_size{k_sizes.back()};
+    if (argc > 1) {
+        max_size = static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+
+    std::cout << "algorithm,input,size,repetitions,ns_per_sort,comparisons,swaps,moves\n";
+    for (const auto size : k_sizes) {
+        if (size > max_size) {
+            break;
+        }
+        for (const auto kind : k_input_kinds) {
+            const auto input = make_input(kind, size);
+            for (const auto algorithm : k_algorithms) {
+                if (is_feasible(algorithm, kind, size)) {
+                    run_case(algorithm, kind, input);
+                    // Flush so that partial results survive an interrupted run.
+                    std::cout.flush();
+                }
+            }
+        }
+    }
+}
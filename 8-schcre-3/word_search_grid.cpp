@@ -9,10 +9,42 @@
 
 #include "word_search_grid.h"
 
+#include <algorithm>        // for std::sort, std::min, std::move
 #include <fstream>          // for std::ifstream
-#include <iterator>         // for std::istream_iterator
+#include <future>           // for std::future
+#include <iterator>         // for std::istream_iterator, std::back_inserter
+#include <string>           // for std::string
+#include <string_view>      // for std::string_view
+#include <tuple>            // for std::tie
 #include <vector>           // for std::vector
 
+#include "dictionary_trie.h"
+
+namespace {
+/// The number of chunks of columns created per worker by the parallel search.
+constexpr std::size_t k_chunks_per_worker{4};
+
+/**
+ * Returns every word of the given dictionary with at least `min_length`
+ * letters that appears in the given word search, by looking up every
+ * candidate sequence with the dictionary's contains().
+ */
+template<typename Lookup>
+std::vector<WordMatch> find_words_by_lookup(
+    const WordSearchGrid& grid,
+    const Lookup& dictionary,
+    std::size_t min_length)
+{
+    std::vector<WordMatch> matches;
+    for (auto it = grid.view_begin(), last = grid.view_end(); it != last; ++it) {
+        if (it->size() >= min_length && dictionary.contains(*it)) {
+            matches.push_back({std::string(*it), it.center(), it.direction()});
+        }
+    }
+    return matches;
+}
+} // end namespace
+
 WordSearchGrid WordSearchGrid::read_file(const char* file_name)
 {
     std::ifstream in_stream(file_name);
@@ -39,5 +71,147 @@ WordSearchGrid WordSearchGrid::read_file(const char* file_name)
     Matrix<Entry> mat(std::move(grid_letters));
     mat.reshape({rows, cols});
     return WordSearchGrid(std::move(mat));
+}
+
+std::vector<WordMatch> WordSearchGrid::find_words(const DictionaryTrie& trie, std::size_t min_length) const
+{
+    std::vector<WordMatch> matches;
+    find_words_in_columns(trie, min_length, 0, dimensions().second, matches);
+    return matches;
+}
+
+std::vector<WordMatch> WordSearchGrid::find_words(
+    const DictionaryTrie& trie,
+    std::size_t min_length,
+    eece2560::ThreadPool& pool) const
+{
+    const auto cols = dimensions().second;
+    // Use a few chunks per worker so that uneven chunks balance out.
+    const auto chunk_count = std::min(cols, k_chunks_per_worker * pool.size());
+
+    std::vector<std::future<std::vector<WordMatch>>> chunk_results;
+    chunk_results.reserve(chunk_count);
+    for (std::size_t chunk{0}; chunk < chunk_count; ++chunk) {
+        const auto first_col = chunk * cols / chunk_count;
+        const auto last_col = (chunk + 1) * cols / chunk_count;
+        chunk_results.push_back(pool.submit([this, &trie, min_length, first_col, last_col]() {
+            std::vector<WordMatch> chunk_matches;
+            find_words_in_columns(trie, min_length, first_col, last_col, chunk_matches);
+            return chunk_matches;
+        }));
+    }
+
+    // Merge in chunk order, which is the order of the sequential search.
+    std::vector<WordMatch> matches;
+    for (auto& result : chunk_results) {
+        auto chunk_matches = result.get();
+        std::move(std::begin(chunk_matches), std::end(chunk_matches), std::back_inserter(matches));
+    }
+    return matches;
+}
+
+std::vector<WordMatch> WordSearchGrid::find_words(const HashDictionary& dictionary, std::size_t min_length) const
+{
+    return find_words_by_lookup(*this, dictionary, min_length);
+}
+
+std::vector<WordMatch> WordSearchGrid::find_words(const Dictionary& dictionary, std::size_t min_length) const
+{
+    return find_words_by_lookup(*this, dictionary, min_length);
+}
+
+std::vector<WordMatch> WordSearchGrid::find_words(const MappedDictionary& dictionary, std::size_t min_length) const
+{
+    std::vector<WordMatch> matches;
+    // The range of words that begin with the current sequence.
+    auto range = dictionary.prefix_root();
+
+    for (auto it = view_begin(), last = view_end(); it != last;) {
+        const std::string_view sequence = *it;
+
+        // Sequences grow by one letter at a time within a direction, so only
+        // the newest letter needs to be matched.
+        const auto next = dictionary.step(sequence.size() == 1 ? dictionary.prefix_root() : range, sequence.back());
+
+        if (!next) {
+            // No word begins with this sequence, so no longer sequence in
+            // this direction can be a word either.
+            it.skip_direction();
+            continue;
+        }
+        range = *next;
+
+        if (sequence.size() >= min_length && dictionary.is_word(range)) {
+            matches.push_back({std::string(sequence), it.center(), it.direction()});
+        }
+        ++it;
+    }
+    return matches;
+}
+
+void WordSearchGrid::find_words_in_columns(
+    const DictionaryTrie& trie,
+    std::size_t min_length,
+    std::size_t first_col,
+    std::size_t last_col,
+    std::vector<WordMatch>& matches) const
+{
+    // Entries are visited top-to-bottom, then left-to-right, so the sequences
+    // starting in a range of columns are contiguous.
+    auto it = OrdinalSequenceViewIter(m_lines, {0, first_col});
+    const auto last = view_end();
+    // The trie node for the prefix formed by the current sequence.
+    DictionaryTrie::NodeIndex node{DictionaryTrie::k_root};
+
+    while (it != last && it.center().second < last_col) {
+        const std::string_view sequence = *it;
+
+        // Sequences grow by one letter at a time within a direction, so only
+        // the newest letter needs to be followed.
+        const auto next = trie.step(sequence.size() == 1 ? DictionaryTrie::k_root : node, sequence.back());
+
+        if (!next) {
+            // No word begins with this sequence, so no longer sequence in
+            // this direction can be a word either.
+            it.skip_direction();
+            continue;
+        }
+        node = *next;
+
+        if (sequence.size() >= min_length && trie.is_word(node)) {
+            matches.push_back({std::string(sequence), it.center(), it.direction()});
+        }
+        ++it;
+    }
+}
+
+std::vector<WordMatch> WordSearchGrid::find_words(const AhoCorasickAutomaton& automaton, std::size_t min_length) const
+{
+    std::vector<WordMatch> matches;
+
+    for (const auto& line : m_lines.lines()) {
+        const auto text = m_lines.text(line);
+        automaton.scan(text, [&](std::size_t end, std::size_t word_length) {
+            const auto start = end - word_length;
+            // Occurrences starting in the second copy of the line repeat
+            // those starting in the first.
+            if (word_length >= min_length && word_length <= line.length && start < line.length) {
+                matches.push_back({
+                    std::string(text.substr(start, word_length)),
+                    m_lines.position(line, start),
+                    line.direction
+                });
+            }
+        });
+    }
 
+    // Order matches as the ordinal sequence iterator would produce them:
+    // by starting position, then direction, then length.
+    std::sort(std::begin(matches), std::end(matches), [](const WordMatch& lhs, const WordMatch& rhs) {
+        const auto lhs_length = lhs.word.size();
+        const auto rhs_length = rhs.word.size();
+        return std::tie(lhs.start.second, lhs.start.first, lhs.direction, lhs_length)
+            < std::tie(rhs.start.second, rhs.start.first, rhs.direction, rhs_length);
+    });
+    return matches;
 }
@@ -10,9 +10,34 @@
 #ifndef EECE_2560_PROJECTS_WORD_SEARCH_GRID_H
 #define EECE_2560_PROJECTS_WORD_SEARCH_GRID_H
 
+#include <iostream>         // for I/O stream definitions
+#include <string>           // for std::string
+#include <type_traits>      // for std::underlying_type_t
+#include <vector>           // for std::vector
+
+#include "aho_corasick.h"
+#include "eece2560_thread_pool.h"
+#include "hash_dictionary.h"
+#include "mapped_dictionary.h"
+#include "dictionary_trie.h"
 #include "matrix.h"
+#include "ordinal_wrapping_lines.h"
 #include "ordinal_wrapping_sequence.h"
 
+/**
+ * A word located in a word search grid.
+ */
+struct WordMatch {
+    /// The word that was found.
+    std::string word;
+
+    /// The position of the first letter of the word.
+    Matrix<char>::Coordinate start;
+
+    /// The direction in which the word is spelled from its first letter.
+    OrdinalDirection direction;
+};
+
 /**
  * A two-dimensional grid of letters comprising a word search puzzle.
  */
@@ -23,10 +48,13 @@ class WordSearchGrid {
     /// This word search's grid of letters.
     Matrix<Entry> m_entries;
 
+    /// The wrap-around lines of the grid, precomputed for zero-copy searches.
+    OrdinalWrappingLines m_lines;
+
   public:
     /// Creates a word search with the given entries.
     explicit WordSearchGrid(Matrix<Entry> entries)
-        : m_entries(std::move(entries)) {};
+        : m_entries(std::move(entries)), m_lines(m_entries) {};
 
     /// Returns the dimensions of this word search.
     [[nodiscard]] Matrix<Entry>::Coordinate dimensions() const {
@@ -56,6 +84,160 @@ class WordSearchGrid {
         return OrdinalWrappingSequenceIter<Entry>();
     }
 
+    /**
+     * Returns an iterator that produces the candidate sequences of begin() as
+     * views into this word search's precomputed lines. Unlike begin(), a
+     * single-letter view is produced for every entry and direction; see
+     * OrdinalSequenceViewIter.
+     */
+    OrdinalSequenceViewIter view_begin() const {
+        return OrdinalSequenceViewIter(m_lines);
+    }
+
+    /**
+     * Returns an end sentinel sequence view iterator.
+     */
+    OrdinalSequenceViewIter view_end() const {
+        return OrdinalSequenceViewIter();
+    }
+
+    /// Returns the precomputed wrap-around lines of this word search.
+    [[nodiscard]] const OrdinalWrappingLines& lines() const noexcept { return m_lines; }
+
+    /**
+     * Returns every word in the given hash dictionary with at least
+     * `min_length` letters that appears in this word search, in the same
+     * order as the overload taking a DictionaryTrie.
+     *
+     * A hash table cannot tell whether any word begins with a sequence, so
+     * every candidate sequence is looked up.
+     */
+    [[nodiscard]] std::vector<WordMatch> find_words(const HashDictionary& dictionary, std::size_t min_length) const;
+
+    /**
+     * Returns every word in the given sorted dictionary with at least
+     * `min_length` letters that appears in this word search, in the same
+     * order as the overload taking a DictionaryTrie.
+     *
+     * Like the hash dictionary search, every candidate sequence is looked up,
+     * here with Dictionary::contains().
+     */
+    [[nodiscard]] std::vector<WordMatch> find_words(const Dictionary& dictionary, std::size_t min_length) const;
+
+    /**
+     * Returns every word in the given compiled dictionary with at least
+     * `min_length` letters that appears in this word search, in the same
+     * order as the overload taking a DictionaryTrie.
+     *
+     * The search is pruned by prefix like the trie search, but narrows a
+     * range of the mapped words instead of following trie edges, so no words
+     * are copied out of the mapping.
+     */
+    [[nodiscard]] std::vector<WordMatch> find_words(const MappedDictionary& dictionary, std::size_t min_length) const;
+
+  private:
+    /**
+     * Appends to `matches` the words in the given trie with at least
+     * `min_length` letters that start in the columns [first_col, last_col).
+     */
+    void find_words_in_columns(
+        const DictionaryTrie& trie,
+        std::size_t min_length,
+        std::size_t first_col,
+        std::size_t last_col,
+        std::vector<WordMatch>& matches
+    ) const;
+
+  public:
+
+    /**
+     * Returns every word in the given trie with at least `min_length` letters
+     * that appears in this word search, in the order that the sequences
+     * produced by begin() would reach them.
+     *
+     * The trie is walked alongside the sequence view iterator, and each
+     * direction is abandoned as soon as no word begins with the current
+     * sequence.
+     */
+    [[nodiscard]] std::vector<WordMatch> find_words(const DictionaryTrie& trie, std::size_t min_length) const;
+
+    /**
+     * Parallel version of find_words(trie, min_length).
+     *
+     * The columns of starting entries are split into chunks that are
+     * searched by the given pool's workers, each into its own buffer. The
+     * buffers are concatenated in chunk order, so the result is identical to
+     * that of the sequential overload.
+     */
+    [[nodiscard]] std::vector<WordMatch> find_words(
+        const DictionaryTrie& trie,
+        std::size_t min_length,
+        eece2560::ThreadPool& pool
+    ) const;
+
+    /**
+     * Returns every word matched by the given automaton with at least
+     * `min_length` letters that appears in this word search.
+     *
+     * Each of the precomputed wrap-around lines is scanned once. The lines
+     * are doubled, so words that wrap past the start of a line are also
+     * found. The matches are returned in the same order as the overload
+     * taking a DictionaryTrie.
+     */
+    [[nodiscard]] std::vector<WordMatch> find_words(
+        const AhoCorasickAutomaton& automaton,
+        std::size_t min_length
+    ) const;
+
 };
 
+/// The available strategies for locating dictionary words in a word search.
+enum class SearchMode { TrieWalk, AhoCorasick, ParallelTrieWalk, HashLookup, SortedLookup };
+
+inline std::istream& operator>>(std::istream& in, SearchMode& mode)
+{
+    using underlying_type = std::underlying_type_t<SearchMode>;
+    constexpr auto first = static_cast<underlying_type>(SearchMode::TrieWalk);
+    constexpr auto last = static_cast<underlying_type>(SearchMode::SortedLookup);
+
+    underlying_type temp;
+    in >> temp;
+
+    // underling_type could be unsigned, so we can't test (temp < first) and
+    // instead need to use inclusive bounds checks.
+    if (!(temp >= first && temp <= last)) {
+        in.setstate(std::ios::failbit);
+    } else {
+        mode = static_cast<SearchMode>(temp);
+    }
+    return in;
+}
+
+inline std::ostream& operator<<(std::ostream& out, SearchMode mode)
+{
+    switch (mode) {
+        case SearchMode::TrieWalk: {
+            out << "TrieWalk";
+            break;
+        }
+        case SearchMode::AhoCorasick: {
+            out << "AhoCorasick";
+            break;
+        }
+        case SearchMode::ParallelTrieWalk: {
+            out << "ParallelTrieWalk";
+            break;
+        }
+        case SearchMode::HashLookup: {
+            out << "HashLookup";
+            break;
+        }
+        case SearchMode::SortedLookup: {
+            out << "SortedLookup";
+            break;
+        }
+    }
+    return out;
+}
+
 #endif //EECE_2560_PROJECTS_WORD_SEARCH_GRID_H
@@ -0,0 +1,60 @@
+/**
+ * Summary statistics of solver call counts for the project 4 tools.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#ifndef EECE_2560_PROJECTS_CALL_STATISTICS_H
+#define EECE_2560_PROJECTS_CALL_STATISTICS_H
+
+#include <algorithm>        // for std::nth_element, std::max_element
+#include <cstddef>          // for std::ptrdiff_t
+#include <numeric>          // for std::accumulate
+#include <vector>           // for std::vector
+
+/// The median and mean of a list of call counts.
+template<typename Count>
+struct CallStatistics {
+    /// The median count. For an even number of counts, the (truncated) mean
+    /// of the two middle counts.
+    Count median;
+
+    /// The mean count.
+    double average;
+};
+
+/**
+ * Computes the median and mean of the given call counts.
+ *
+ * The counts are partially sorted to find the median without a full sort, so
+ * their order is not preserved. The behavior of this function is not defined
+ * if no counts are given.
+ *
+ * @param counts Non-empty list of call counts.
+ * @return Median and mean of the counts.
+ */
+template<typename Count>
+CallStatistics<Count> call_statistics(std::vector<Count>& counts)
+{
+    const auto count = counts.size();
+
+    const auto average = static_cast<double>(std::accumulate(
+        std::cbegin(counts),
+        std::cend(counts),
+        Count{0})) / static_cast<double>(count);
+
+    const auto middle = std::begin(counts) + static_cast<std::ptrdiff_t>(count / 2);
+    std::nth_element(std::begin(counts), middle, std::end(counts));
+    auto median = *middle;
+    if (count % 2 == 0) {
+        // The lower middle count is the largest of those before `middle`.
+        median = (*std::max_element(std::begin(counts), middle) + median) / 2;
+    }
+
+    return {median, average};
+}
+
+#endif //EECE_2560_PROJECTS_CALL_STATISTICS_H
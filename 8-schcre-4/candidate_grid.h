@@ -0,0 +1,505 @@
+/**
+ * Incremental Sudoku candidate tracking and constraint propagation for
+ * project 4.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
+ *  [2] https://norvig.com/sudoku.html
+ *  [3] https://www.sudokuwiki.org/Intersection_Removal
+ */
+
+#ifndef EECE_2560_PROJECTS_CANDIDATE_GRID_H
+#define EECE_2560_PROJECTS_CANDIDATE_GRID_H
+
+#include <array>            // for std::array
+#include <cstddef>          // for std::size_t
+#include <cstdint>          // for std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <optional>         // for std::optional
+#include <type_traits>      // for std::conditional_t
+#include <vector>           // for std::vector
+
+namespace details {
+/**
+ * The smallest unsigned integer type with at least N bits, used to store one
+ * bit per entry value of a board with N rows.
+ */
+template<std::size_t N>
+using ConflictMask = std::conditional_t<
+    (N <= 16),
+    std::uint16_t,
+    std::conditional_t<(N <= 32), std::uint32_t, std::uint64_t>
+>;
+
+/// A ConflictMask with the bits of every entry value of a board with N rows set.
+template<std::size_t N>
+constexpr ConflictMask<N> k_all_entries_mask{
+    static_cast<ConflictMask<N>>(N == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << (N % 64)) - 1)
+};
+
+/// Returns the number of set bits in the given mask [1].
+template<typename Mask>
+constexpr unsigned int mask_popcount(Mask mask)
+{
+    return static_cast<unsigned int>(__builtin_popcountll(mask));
+}
+
+/// Returns the index of the lowest set bit in the given mask, which must not be zero [1].
+template<typename Mask>
+constexpr std::size_t mask_lowest_index(Mask mask)
+{
+    return static_cast<std::size_t>(__builtin_ctzll(mask));
+}
+
+/// Returns the given mask with its lowest set bit cleared.
+template<typename Mask>
+constexpr Mask mask_without_lowest(Mask mask)
+{
+    return static_cast<Mask>(mask & (mask - 1));
+}
+
+/**
+ * The remaining candidate entries of every cell of a Sudoku board with
+ * characteristic size N, maintained incrementally as cells are assigned.
+ *
+ * Assigning an entry to a cell removes it from the candidates of the cell's
+ * peers (the other cells in its row, column, and block). propagate() then
+ * repeatedly applies deductions that are forced by the candidates [2]:
+ *
+ *  - naked singles: a cell with one candidate must take it,
+ *  - hidden singles: an entry with one possible cell in a row, column, or
+ *    block must go there, and
+ *  - locked candidates [3]: if the cells of a block that can take an entry all
+ *    lie in one row or column, no other cell of that row or column can take
+ *    it, and vice versa.
+ *
+ * Every change is recorded on a trail, so that a search can return to an
+ * earlier state with undo() instead of copying the grid. The trail and the
+ * work queue are allocated once, at their largest possible size, so no
+ * operation allocates.
+ *
+ * Cells are numbered left-to-right, top-to-bottom and entries are numbered by
+ * index in [0, N*N).
+ *
+ * @tparam N Characteristic board size. Boards have N*N rows and columns.
+ */
+template<std::size_t N>
+class CandidateGrid {
+  public:
+    /// The number of rows / number of columns on the board.
+    constexpr static std::size_t k_dim{N * N};
+
+    /// The number of cells on the board.
+    constexpr static std::size_t k_cells{k_dim * k_dim};
+
+    static_assert(k_dim <= 64, "candidate masks support at most 64 entry values");
+
+    /// Bitmask with one bit per entry value.
+    using Mask = ConflictMask<k_dim>;
+
+    /// Mask with the bits of every entry value set.
+    constexpr static Mask k_all_entries{k_all_entries_mask<k_dim>};
+
+  private:
+    /// Type used to store cell numbers.
+    using Cell = std::uint16_t;
+
+    /// Value stored for cells that have not been assigned.
+    constexpr static std::uint8_t k_unassigned{0xFF};
+
+    /// The number of rows, columns, and blocks.
+    constexpr static std::size_t k_unit_count{3 * k_dim};
+
+    /// The number of distinct cells that share a row, column, or block with a cell.
+    constexpr static std::size_t k_peer_count{3 * (k_dim - 1) - 2 * (N - 1)};
+
+    /// Board layout tables shared by every grid of the same size.
+    struct Geometry {
+        /// The cells of each row, then of each column, then of each block.
+        std::array<std::array<Cell, k_dim>, k_unit_count> units;
+
+        /// The peers of each cell.
+        std::array<std::array<Cell, k_peer_count>, k_cells> peers;
+    };
+
+    /// The state of a cell before a change, for undo().
+    struct TrailEntry {
+        Cell cell;
+        std::uint8_t value;
+        Mask candidates;
+    };
+
+    /// Layout tables for this board size.
+    const Geometry* m_geometry;
+
+    /// The candidates of each cell. An assigned cell's only candidate is its entry.
+    std::array<Mask, k_cells> m_candidates;
+
+    /// The entry index assigned to each cell, or k_unassigned.
+    std::array<std::uint8_t, k_cells> m_values;
+
+    /// The number of cells that have not been assigned.
+    std::size_t m_unassigned{k_cells};
+
+    /// Previous states of every changed cell, most recent last.
+    std::vector<TrailEntry> m_trail;
+
+    /// Unassigned cells that have been reduced to a single candidate.
+    std::vector<Cell> m_singles;
+
+  public:
+    /// Creates a grid in which every cell is unassigned and may take any entry.
+    CandidateGrid() : m_geometry(&geometry())
+    {
+        m_candidates.fill(k_all_entries);
+        m_values.fill(k_unassigned);
+        // Along any search path, a cell loses each of its k_dim candidates at
+        // most once and is assigned at most once.
+        m_trail.reserve(k_cells * (k_dim + 1));
+        m_singles.reserve(k_cells);
+    }
+
+    /// Returns the cell with the given row and column.
+    constexpr static std::size_t cell_of(std::size_t row, std::size_t col) { return row * k_dim + col; }
+
+    /// Returns true if every cell has been assigned.
+    [[nodiscard]] bool solved() const noexcept { return m_unassigned == 0; }
+
+    /// Returns true if the given cell has been assigned.
+    [[nodiscard]] bool assigned(std::size_t cell) const { return m_values[cell] != k_unassigned; }
+
+    /// Returns the entry index assigned to the given cell, which must be assigned.
+    [[nodiscard]] std::size_t value(std::size_t cell) const { return m_values[cell]; }
+
+    /// Returns the remaining candidates of the given cell.
+    [[nodiscard]] Mask candidates(std::size_t cell) const { return m_candidates[cell]; }
+
+    /// Returns a position on the trail to which the grid can later be returned.
+    [[nodiscard]] std::size_t mark() const noexcept { return m_trail.size(); }
+
+    /// Reverts every change made since the given mark() was taken.
+    void undo(std::size_t mark)
+    {
+        while (m_trail.size() > mark) {
+            const auto entry = m_trail.back();
+            m_trail.pop_back();
+            if (entry.value == k_unassigned && m_values[entry.cell] != k_unassigned) {
+                ++m_unassigned;
+            }
+            m_values[entry.cell] = entry.value;
+            m_candidates[entry.cell] = entry.candidates;
+        }
+        m_singles.clear();
+    }
+
+    /// Forgets the trail, making the current state the earliest one undo() can return to.
+    void commit() noexcept { m_trail.clear(); }
+
+    /**
+     * Assigns the given entry to the given cell and removes it from the
+     * candidates of the cell's peers.
+     *
+     * @return false if this leaves the grid in a contradiction. The grid
+     *         should then be returned to an earlier mark().
+     */
+    bool assign(std::size_t cell, std::size_t entry_index)
+    {
+        const auto bit = static_cast<Mask>(Mask{1} << entry_index);
+        if ((m_candidates[cell] & bit) == 0) {
+            return false;
+        }
+        if (m_values[cell] != k_unassigned) {
+            // The cell already holds this entry.
+            return true;
+        }
+
+        record(cell);
+        m_candidates[cell] = bit;
+        m_values[cell] = static_cast<std::uint8_t>(entry_index);
+        --m_unassigned;
+
+        for (const Cell peer : m_geometry->peers[cell]) {
+            if (!eliminate(peer, bit)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Applies naked single, hidden single, and locked candidate deductions
+     * until none apply.
+     *
+     * @return false if the grid has no solution.
+     */
+    bool propagate()
+    {
+        while (true) {
+            if (!assign_naked_singles() || !assign_hidden_singles()) {
+                m_singles.clear();
+                return false;
+            }
+            if (!m_singles.empty()) {
+                // Hidden singles produced new naked singles.
+                continue;
+            }
+
+            // Only look for locked candidates once the cheaper deductions are exhausted.
+            const auto before = mark();
+            if (!eliminate_locked_candidates()) {
+                m_singles.clear();
+                return false;
+            }
+            if (mark() == before) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * Returns the unassigned cell with the fewest candidates, which is the
+     * best cell to branch on, or an empty optional if every cell is assigned.
+     */
+    [[nodiscard]] std::optional<std::size_t> branch_cell() const
+    {
+        std::optional<std::size_t> best;
+        unsigned int best_count{k_dim + 1};
+        for (std::size_t cell{0}; cell < k_cells; ++cell) {
+            if (m_values[cell] != k_unassigned) {
+                continue;
+            }
+            const auto count = details::mask_popcount(m_candidates[cell]);
+            if (count < best_count) {
+                best = cell;
+                best_count = count;
+                if (count <= 1) {
+                    break;
+                }
+            }
+        }
+        return best;
+    }
+
+  private:
+    /// Returns the layout tables for this board size, computing them on first use.
+    static const Geometry& geometry()
+    {
+        static const Geometry k_geometry = []() {
+            Geometry result{};
+            for (std::size_t i{0}; i < k_dim; ++i) {
+                for (std::size_t j{0}; j < k_dim; ++j) {
+                    result.units[i][j] = static_cast<Cell>(cell_of(i, j));
+                    result.units[k_dim + i][j] = static_cast<Cell>(cell_of(j, i));
+                    result.units[2 * k_dim + i][j] = static_cast<Cell>(cell_of(
+                        N * (i / N) + j / N,
+                        N * (i % N) + j % N
+                    ));
+                }
+            }
+            for (std::size_t cell{0}; cell < k_cells; ++cell) {
+                const auto row = cell / k_dim;
+                const auto col = cell % k_dim;
+                std::size_t count{0};
+                const auto add = [&](std::size_t peer) {
+                    if (peer == cell) {
+                        return;
+                    }
+                    for (std::size_t i{0}; i < count; ++i) {
+                        if (result.peers[cell][i] == peer) {
+                            return;
+                        }
+                    }
+                    result.peers[cell][count] = static_cast<Cell>(peer);
+                    ++count;
+                };
+                for (const auto peer : result.units[row]) {
+                    add(peer);
+                }
+                for (const auto peer : result.units[k_dim + col]) {
+                    add(peer);
+                }
+                for (const auto peer : result.units[2 * k_dim + N * (row / N) + col / N]) {
+                    add(peer);
+                }
+            }
+            return result;
+        }();
+        return k_geometry;
+    }
+
+    /// Saves the current state of the given cell on the trail.
+    void record(std::size_t cell)
+    {
+        m_trail.push_back({static_cast<Cell>(cell), m_values[cell], m_candidates[cell]});
+    }
+
+    /**
+     * Removes the given entries from the candidates of the given cell.
+     *
+     * @return false if the cell is left without candidates, or holds one of
+     *         the removed entries.
+     */
+    bool eliminate(std::size_t cell, Mask entries)
+    {
+        auto& candidates = m_candidates[cell];
+        if ((candidates & entries) == 0) {
+            return true;
+        }
+        if (m_values[cell] != k_unassigned) {
+            // The cell has been assigned one of the removed entries.
+            return false;
+        }
+
+        record(cell);
+        candidates = static_cast<Mask>(candidates & ~entries);
+        if (candidates == 0) {
+            return false;
+        }
+        if (details::mask_without_lowest(candidates) == 0) {
+            m_singles.push_back(static_cast<Cell>(cell));
+        }
+        return true;
+    }
+
+    /// Assigns every cell that has a single candidate, including those that
+    /// become singles along the way.
+    bool assign_naked_singles()
+    {
+        while (!m_singles.empty()) {
+            const auto cell = m_singles.back();
+            m_singles.pop_back();
+            if (m_values[cell] == k_unassigned
+                && !assign(cell, details::mask_lowest_index(m_candidates[cell]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Assigns every entry that can only go in one cell of some row, column, or block.
+    bool assign_hidden_singles()
+    {
+        for (const auto& unit : m_geometry->units) {
+            // Entries that are candidates in at least one, and in at least two,
+            // unassigned cells of the unit.
+            Mask once{0};
+            Mask twice{0};
+            Mask placed{0};
+            for (const auto cell : unit) {
+                const auto candidates = m_candidates[cell];
+                if (m_values[cell] != k_unassigned) {
+                    placed |= candidates;
+                } else {
+                    twice |= static_cast<Mask>(once & candidates);
+                    once |= candidates;
+                }
+            }
+            if (static_cast<Mask>(once | placed) != k_all_entries) {
+                // Some entry cannot be placed anywhere in the unit.
+                return false;
+            }
+
+            for (auto hidden = static_cast<Mask>(once & ~twice & ~placed);
+                 hidden != 0;
+                 hidden = details::mask_without_lowest(hidden)) {
+                const auto entry_index = details::mask_lowest_index(hidden);
+                const auto bit = static_cast<Mask>(Mask{1} << entry_index);
+                bool found{false};
+                for (const auto cell : unit) {
+                    if (m_values[cell] == k_unassigned && (m_candidates[cell] & bit) != 0) {
+                        if (!assign(cell, entry_index)) {
+                            return false;
+                        }
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found) {
+                    // An earlier hidden single in this unit took the only cell.
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Removes locked candidates: entries confined to the intersection of a
+     * block with a row or column within one of the two units are removed
+     * from the rest of the other unit.
+     */
+    bool eliminate_locked_candidates()
+    {
+        for (std::size_t line_kind{0}; line_kind < 2; ++line_kind) {
+            for (std::size_t line{0}; line < k_dim; ++line) {
+                const auto& line_cells = m_geometry->units[line_kind * k_dim + line];
+
+                // Union of the unassigned candidates in each of the N
+                // segments where the line crosses a block.
+                std::array<Mask, N> segments{};
+                for (std::size_t i{0}; i < k_dim; ++i) {
+                    const auto cell = line_cells[i];
+                    if (m_values[cell] == k_unassigned) {
+                        segments[i / N] |= m_candidates[cell];
+                    }
+                }
+
+                for (std::size_t segment{0}; segment < N; ++segment) {
+                    const auto block = line_kind == 0
+                        ? N * (line / N) + segment
+                        : N * segment + line / N;
+                    const auto& block_cells = m_geometry->units[2 * k_dim + block];
+
+                    // Union of the candidates of the block outside the line.
+                    Mask block_rest{0};
+                    Mask line_rest{0};
+                    for (std::size_t other{0}; other < N; ++other) {
+                        if (other != segment) {
+                            line_rest |= segments[other];
+                        }
+                    }
+                    for (const auto cell : block_cells) {
+                        if (m_values[cell] == k_unassigned && !on_line(cell, line_kind, line)) {
+                            block_rest |= m_candidates[cell];
+                        }
+                    }
+
+                    // Entries confined to the segment within the line (claiming)
+                    // cannot appear elsewhere in the block, and entries confined
+                    // to the segment within the block (pointing) cannot appear
+                    // elsewhere in the line.
+                    const auto claiming = static_cast<Mask>(segments[segment] & ~line_rest & block_rest);
+                    const auto pointing = static_cast<Mask>(segments[segment] & ~block_rest & line_rest);
+                    if (claiming != 0) {
+                        for (const auto cell : block_cells) {
+                            if (!on_line(cell, line_kind, line) && !eliminate(cell, claiming)) {
+                                return false;
+                            }
+                        }
+                    }
+                    if (pointing != 0) {
+                        for (std::size_t i{0}; i < k_dim; ++i) {
+                            if (i / N != segment && !eliminate(line_cells[i], pointing)) {
+                                return false;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /// Returns true if the given cell lies on the given row (kind 0) or column (kind 1).
+    constexpr static bool on_line(std::size_t cell, std::size_t line_kind, std::size_t line)
+    {
+        return (line_kind == 0 ? cell / k_dim : cell % k_dim) == line;
+    }
+};
+} // end namespace details
+
+#endif //EECE_2560_PROJECTS_CANDIDATE_GRID_H
@@ -0,0 +1,229 @@
+/**
+ * Exact cover solver for project 4.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ * References
+ * ==========
+ *  [1] https://arxiv.org/abs/cs/0011047 (Knuth, "Dancing Links")
+ *  [2] https://en.wikipedia.org/wiki/Exact_cover#Sudoku
+ */
+
+#ifndef EECE_2560_PROJECTS_DANCING_LINKS_H
+#define EECE_2560_PROJECTS_DANCING_LINKS_H
+
+#include <cstddef>          // for std::size_t
+#include <cstdint>          // for std::uint32_t, std::uint64_t
+#include <iterator>         // for std::distance
+#include <vector>           // for std::vector
+
+/**
+ * An exact cover problem solved with Knuth's Algorithm X using dancing links [1].
+ *
+ * The problem is a set of columns (constraints) and a set of rows (choices),
+ * each of which covers some of the columns. A solution is a set of rows that
+ * covers every column exactly once.
+ *
+ * The sparse matrix of ones is stored as a circular, doubly linked list in
+ * each row and each column. Rather than allocating each node separately, all
+ * nodes live in a single array and link to each other by index, so building
+ * the matrix performs one allocation per array and the search performs none.
+ */
+class DancingLinks {
+  public:
+    /// Type used to identify nodes, columns, and rows.
+    using Index = std::uint32_t;
+
+  private:
+    /// A one in the sparse matrix, or a column header.
+    struct Node {
+        Index left;
+        Index right;
+        Index up;
+        Index down;
+        /// The header node of the column containing this node.
+        Index column;
+        /// The caller's identifier for the row containing this node.
+        Index row;
+    };
+
+    /// Index of the root node, which links the headers of uncovered columns.
+    constexpr static Index k_root{0};
+
+    /**
+     * All nodes. Index 0 is the root, indices 1 through the column count are
+     * the column headers, and the remaining nodes belong to rows.
+     */
+    std::vector<Node> m_nodes;
+
+    /// The number of nodes remaining in each column, indexed by header node.
+    std::vector<Index> m_sizes;
+
+    /// The rows chosen on the current search path.
+    std::vector<Index> m_partial;
+
+    /// The first solution found by the last search.
+    std::vector<Index> m_solution;
+
+    /// The number of solutions found by the last search.
+    std::size_t m_solution_count{0};
+
+    /// The number of solutions after which the search stops.
+    std::size_t m_limit{1};
+
+    /// The number of search nodes visited by the last search.
+    std::uint64_t m_calls{0};
+
+  public:
+    /// Creates an exact cover problem with the given number of columns and no rows.
+    explicit DancingLinks(std::size_t column_count)
+        : m_nodes(column_count + 1), m_sizes(column_count + 1, 0)
+    {
+        for (Index i{0}; i <= column_count; ++i) {
+            m_nodes[i] = Node{
+                i == 0 ? static_cast<Index>(column_count) : i - 1,
+                i == column_count ? k_root : i + 1,
+                i,
+                i,
+                i,
+                0
+            };
+        }
+    }
+
+    /**
+     * Adds a row that covers the given columns.
+     *
+     * @param row_id Identifier reported for this row in solutions.
+     * @param first,last Range of column indices in [0, column count).
+     */
+    template<typename Iter>
+    void add_row(Index row_id, Iter first, Iter last)
+    {
+        const auto row_start = static_cast<Index>(m_nodes.size());
+        const auto row_size = static_cast<Index>(std::distance(first, last));
+        for (Index offset{0}; first != last; ++first, ++offset) {
+            const auto column = static_cast<Index>(*first + 1);
+            const auto node = row_start + offset;
+            // Insert the node at the bottom of its column.
+            m_nodes.push_back(Node{
+                offset == 0 ? row_start + row_size - 1 : node - 1,
+                offset + 1 == row_size ? row_start : node + 1,
+                m_nodes[column].up,
+                column,
+                column,
+                row_id
+            });
+            m_nodes[m_nodes[column].up].down = node;
+            m_nodes[column].up = node;
+            ++m_sizes[column];
+        }
+    }
+
+    /**
+     * Searches for exact covers, stopping once `limit` solutions have been
+     * found. The matrix is restored before this function returns, so it may
+     * be searched again.
+     *
+     * @return The number of solutions found, which is at most `limit`.
+     */
+    std::size_t search(std::size_t limit = 1)
+    {
+        m_limit = limit;
+        m_solution_count = 0;
+        m_calls = 0;
+        m_partial.clear();
+        m_solution.clear();
+        if (m_limit > 0) {
+            search_level();
+        }
+        return m_solution_count;
+    }
+
+    /// Returns the rows of the first solution found by the last search.
+    [[nodiscard]] const std::vector<Index>& solution() const noexcept { return m_solution; }
+
+    /// Returns the number of search nodes visited by the last search.
+    [[nodiscard]] std::uint64_t call_count() const noexcept { return m_calls; }
+
+  private:
+    /// Removes the given column and every row that covers it from the matrix.
+    void cover(Index column)
+    {
+        m_nodes[m_nodes[column].right].left = m_nodes[column].left;
+        m_nodes[m_nodes[column].left].right = m_nodes[column].right;
+        for (Index row = m_nodes[column].down; row != column; row = m_nodes[row].down) {
+            for (Index node = m_nodes[row].right; node != row; node = m_nodes[node].right) {
+                m_nodes[m_nodes[node].down].up = m_nodes[node].up;
+                m_nodes[m_nodes[node].up].down = m_nodes[node].down;
+                --m_sizes[m_nodes[node].column];
+            }
+        }
+    }
+
+    /// Reverses cover(column). Covers must be undone in the reverse order.
+    void uncover(Index column)
+    {
+        for (Index row = m_nodes[column].up; row != column; row = m_nodes[row].up) {
+            for (Index node = m_nodes[row].left; node != row; node = m_nodes[node].left) {
+                ++m_sizes[m_nodes[node].column];
+                m_nodes[m_nodes[node].down].up = node;
+                m_nodes[m_nodes[node].up].down = node;
+            }
+        }
+        m_nodes[m_nodes[column].right].left = column;
+        m_nodes[m_nodes[column].left].right = column;
+    }
+
+    /**
+     * Algorithm X. Returns true once the solution limit has been reached, after
+     * restoring the matrix.
+     */
+    bool search_level()
+    {
+        ++m_calls;
+
+        if (m_nodes[k_root].right == k_root) {
+            // Every column is covered.
+            if (m_solution_count == 0) {
+                m_solution = m_partial;
+            }
+            ++m_solution_count;
+            return m_solution_count >= m_limit;
+        }
+
+        // Branch on the column with the fewest rows.
+        Index column = m_nodes[k_root].right;
+        for (Index it = m_nodes[column].right; it != k_root; it = m_nodes[it].right) {
+            if (m_sizes[it] < m_sizes[column]) {
+                column = it;
+            }
+        }
+        if (m_sizes[column] == 0) {
+            // The column cannot be covered.
+            return false;
+        }
+
+        bool done{false};
+        cover(column);
+        for (Index row = m_nodes[column].down; row != column && !done; row = m_nodes[row].down) {
+            m_partial.push_back(m_nodes[row].row);
+            for (Index node = m_nodes[row].right; node != row; node = m_nodes[node].right) {
+                cover(m_nodes[node].column);
+            }
+
+            done = search_level();
+
+            for (Index node = m_nodes[row].left; node != row; node = m_nodes[node].left) {
+                uncover(m_nodes[node].column);
+            }
+            m_partial.pop_back();
+        }
+        uncover(column);
+        return done;
+    }
+};
+
+#endif //EECE_2560_PROJECTS_DANCING_LINKS_H
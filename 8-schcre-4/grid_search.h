@@ -0,0 +1,367 @@
+/**
+ * Non-recursive backtracking search over Sudoku candidate grids for project 4.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#ifndef EECE_2560_PROJECTS_GRID_SEARCH_H
+#define EECE_2560_PROJECTS_GRID_SEARCH_H
+
+#include <atomic>           // for std::atomic
+#include <cstddef>          // for std::size_t
+#include <cstdint>          // for std::uint64_t
+#include <future>           // for std::future
+#include <memory>           // for std::make_unique
+#include <optional>         // for std::optional
+#include <thread>           // for std::this_thread
+#include <utility>          // for std::exchange, std::move
+#include <vector>           // for std::vector
+
+#include "candidate_grid.h"
+#include "eece2560_concurrent_queue.h"
+#include "eece2560_thread_pool.h"
+
+namespace details {
+/**
+ * Depth-first search for the solutions of a CandidateGrid, driven by an
+ * explicit stack rather than by recursion.
+ *
+ * Each stack frame records the cell being guessed, the candidates that have
+ * not yet been tried in it, and the trail mark from before the first guess.
+ * Backtracking undoes the grid to that mark, so the search never copies the
+ * grid. The stack holds at most one frame per cell and is allocated once, so
+ * the search neither allocates per node nor risks overflowing the call stack
+ * on large boards.
+ *
+ * After every guess the grid is propagated, and each new frame branches on
+ * the cell with the fewest candidates.
+ *
+ * @tparam N Characteristic board size.
+ */
+template<std::size_t N>
+class GridSearch {
+  public:
+    using Grid = CandidateGrid<N>;
+
+    /// Statistics reported by a search.
+    struct Result {
+        /// The number of solutions found.
+        std::uint64_t solutions;
+        /// The number of search nodes visited, counting the initial grid.
+        std::uint64_t nodes;
+    };
+
+    /// An untried part of a search: a grid, one of its unassigned cells, and
+    /// the candidates of that cell that have not been tried yet.
+    struct Branch {
+        Grid grid;
+        std::size_t cell;
+        typename Grid::Mask remaining;
+    };
+
+  private:
+    /// A cell being guessed.
+    struct Frame {
+        std::size_t cell;
+        typename Grid::Mask remaining;
+        std::size_t mark;
+    };
+
+    /// The guesses on the current search path.
+    std::vector<Frame> m_frames;
+
+  public:
+    /// Creates a search with its stack allocated for the largest possible depth.
+    GridSearch() { m_frames.reserve(Grid::k_cells); }
+
+    /**
+     * Searches for solutions of the given grid, which must already be
+     * propagated, until `limit` solutions have been found or the search
+     * space is exhausted.
+     *
+     * If the limit is reached, the grid is left holding the last solution
+     * found. Otherwise, the grid is returned to its original state.
+     *
+     * @param grid Grid to be solved.
+     * @param limit Number of solutions after which the search stops.
+     * @param on_solution Callable invoked with the grid for every solution.
+     * @param cancel Optional flag that, once set, ends the search early.
+     */
+    template<typename OnSolution>
+    Result run(
+        Grid& grid,
+        std::uint64_t limit,
+        OnSolution on_solution,
+        const std::atomic<bool>* cancel = nullptr)
+    {
+        m_frames.clear();
+
+        if (grid.solved()) {
+            on_solution(static_cast<const Grid&>(grid));
+            return Result{1, 1};
+        }
+
+        const auto root_mark = grid.mark();
+        push_frame(grid);
+
+        auto result = search(grid, limit, on_solution, cancel, [](GridSearch&, const Grid&) {});
+        // Count the initial grid.
+        ++result.nodes;
+        if (result.solutions < limit) {
+            grid.undo(root_mark);
+        }
+        return result;
+    }
+
+    /**
+     * Searches the given branch like run(), trying only its remaining
+     * candidates in its cell. The branch itself is not counted as a node.
+     *
+     * After every new node that does not solve the grid, `on_node` is invoked
+     * with this search and the grid. It may call split() to hand part of the
+     * search to someone else.
+     *
+     * @param branch Branch to be searched. Its grid is left holding the last
+     *               solution found if the limit is reached.
+     * @param limit Number of solutions after which the search stops.
+     * @param on_solution Callable invoked with the grid for every solution.
+     * @param cancel Optional flag that, once set, ends the search early.
+     * @param on_node Callable invoked with this search and the grid after
+     *                every new node.
+     */
+    template<typename OnSolution, typename OnNode>
+    Result run_branch(
+        Branch& branch,
+        std::uint64_t limit,
+        OnSolution on_solution,
+        const std::atomic<bool>* cancel,
+        OnNode on_node)
+    {
+        m_frames.clear();
+
+        const auto root_mark = branch.grid.mark();
+        m_frames.push_back({branch.cell, branch.remaining, root_mark});
+
+        const auto result = search(branch.grid, limit, on_solution, cancel, on_node);
+        if (result.solutions < limit) {
+            branch.grid.undo(root_mark);
+        }
+        return result;
+    }
+
+    /**
+     * Removes the untried candidates of the shallowest guess on the current
+     * search path, other than the newest one, and returns them as a branch
+     * that another search can try. These are the candidates this search would
+     * otherwise backtrack into last, so they tend to hold the most work.
+     *
+     * @param grid The grid currently being searched.
+     * @return The removed branch, or std::nullopt if no guess on the path has
+     *         untried candidates.
+     */
+    std::optional<Branch> split(const Grid& grid)
+    {
+        // The newest frame is the node being expanded, so it is kept.
+        for (std::size_t i{0}; i + 1 < m_frames.size(); ++i) {
+            auto& frame = m_frames[i];
+            if (frame.remaining != 0) {
+                Branch branch{grid, frame.cell, std::exchange(frame.remaining, 0)};
+                branch.grid.undo(frame.mark);
+                branch.grid.commit();
+                return branch;
+            }
+        }
+        return std::nullopt;
+    }
+
+  private:
+    /// Runs the search loop over the frames already on the stack.
+    template<typename OnSolution, typename OnNode>
+    Result search(
+        Grid& grid,
+        std::uint64_t limit,
+        OnSolution& on_solution,
+        const std::atomic<bool>* cancel,
+        OnNode on_node)
+    {
+        Result result{0, 0};
+
+        while (!m_frames.empty()) {
+            if (cancel && cancel->load(std::memory_order_relaxed)) {
+                break;
+            }
+
+            auto& frame = m_frames.back();
+            // Undo the previous guess made in this frame, if any.
+            grid.undo(frame.mark);
+
+            if (frame.remaining == 0) {
+                // Every candidate of this cell has been tried.
+                m_frames.pop_back();
+                continue;
+            }
+
+            const auto entry_index = details::mask_lowest_index(frame.remaining);
+            frame.remaining = details::mask_without_lowest(frame.remaining);
+            if (!grid.assign(frame.cell, entry_index) || !grid.propagate()) {
+                continue;
+            }
+            ++result.nodes;
+
+            if (grid.solved()) {
+                ++result.solutions;
+                on_solution(static_cast<const Grid&>(grid));
+                if (result.solutions >= limit) {
+                    return result;
+                }
+                continue;
+            }
+            push_frame(grid);
+            on_node(*this, static_cast<const Grid&>(grid));
+        }
+
+        return result;
+    }
+
+    /// Pushes a frame that guesses the cell of the grid with the fewest candidates.
+    void push_frame(const Grid& grid)
+    {
+        const auto cell = *grid.branch_cell();
+        m_frames.push_back({cell, grid.candidates(cell), grid.mark()});
+    }
+};
+
+/**
+ * Searches for a solution of the given grid, which must already be
+ * propagated, on the workers of the given thread pool.
+ *
+ * The search is shared out by work stealing. Every worker owns a queue of
+ * branches, and runs a GridSearch over one branch at a time. Whenever more
+ * workers are idle than there are branches waiting in the queues, a busy
+ * worker splits the untried candidates of the shallowest guess on its search
+ * path into a new branch on its own queue. A worker that runs out of work
+ * takes the oldest branch from its own queue or, failing that, steals the
+ * oldest branch from another worker's queue. Since the shallowest guesses
+ * are split off first, a thief takes the largest untried parts of a search,
+ * and a deep subtree keeps being split for as long as other workers are idle.
+ *
+ * As soon as any worker finds a solution, a shared flag cancels the searches
+ * of the others.
+ *
+ * This function waits on the pool, so it must not be called from one of the
+ * pool's own tasks.
+ *
+ * @param grid Grid to be solved. Left holding the solution if one is found,
+ *             and unchanged otherwise.
+ * @param pool Thread pool that runs the searches.
+ * @return The number of solutions found (0 or 1) and the total number of
+ *         search nodes visited by all workers.
+ */
+template<std::size_t N>
+typename GridSearch<N>::Result parallel_grid_search(CandidateGrid<N>& grid, eece2560::ThreadPool& pool)
+{
+    using Grid = CandidateGrid<N>;
+    using Search = GridSearch<N>;
+    using Branch = typename Search::Branch;
+    using Result = typename Search::Result;
+
+    if (grid.solved()) {
+        return Result{1, 1};
+    }
+
+    const auto worker_count = pool.size();
+    const auto queues = std::make_unique<eece2560::ConcurrentQueue<Branch>[]>(worker_count);
+
+    // The whole search starts as a single branch on the first worker's queue.
+    {
+        Grid root = grid;
+        root.commit();
+        const auto cell = *root.branch_cell();
+        const auto candidates = root.candidates(cell);
+        queues[0].push(Branch{std::move(root), cell, candidates});
+    }
+
+    // The number of branches that have not been searched to completion.
+    std::atomic<std::size_t> pending{1};
+    // The number of branches waiting in the queues.
+    std::atomic<std::size_t> queued{1};
+    // The number of workers that are not searching a branch.
+    std::atomic<std::size_t> idle{worker_count};
+    // Set when a solution is found or a worker fails, to stop every worker.
+    std::atomic<bool> stop{false};
+    std::atomic<bool> found{false};
+    // The initial grid counts as one node.
+    std::atomic<std::uint64_t> search_nodes{1};
+
+    std::vector<std::future<void>> workers;
+    workers.reserve(worker_count);
+    for (std::size_t i{0}; i < worker_count; ++i) {
+        workers.push_back(pool.submit([&, i]() {
+            Search search;
+            std::uint64_t worker_nodes{0};
+
+            // Splits off part of this worker's search while other workers
+            // have nothing to take.
+            const auto share = [&](Search& owner, const Grid& working) {
+                if (idle.load(std::memory_order_relaxed) <= queued.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                if (auto branch = owner.split(working)) {
+                    ++pending;
+                    queues[i].push(std::move(*branch));
+                    queued.fetch_add(1, std::memory_order_relaxed);
+                }
+            };
+
+            try {
+                while (!stop.load(std::memory_order_relaxed) && pending.load() > 0) {
+                    std::optional<Branch> branch;
+                    for (std::size_t k{0}; k < worker_count && !branch; ++k) {
+                        branch = queues[(i + k) % worker_count].try_pop();
+                    }
+                    if (!branch) {
+                        // Other workers are still searching, and may yet split off more branches.
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    queued.fetch_sub(1, std::memory_order_relaxed);
+                    idle.fetch_sub(1, std::memory_order_relaxed);
+
+                    const auto result = search.run_branch(*branch, 1, [](const Grid&) {}, &stop, share);
+                    worker_nodes += result.nodes;
+                    if (result.solutions > 0 && !found.exchange(true)) {
+                        // Only the first worker to find a solution writes it.
+                        grid = std::move(branch->grid);
+                        grid.commit();
+                        stop = true;
+                    }
+
+                    idle.fetch_add(1, std::memory_order_relaxed);
+                    --pending;
+                }
+            } catch (...) {
+                // The other workers would otherwise wait forever for this worker's branches.
+                stop = true;
+                throw;
+            }
+            search_nodes.fetch_add(worker_nodes, std::memory_order_relaxed);
+        }));
+    }
+
+    // Wait for every worker before rethrowing any exception, since the workers
+    // refer to this function's locals.
+    for (auto& worker : workers) {
+        worker.wait();
+    }
+    for (auto& worker : workers) {
+        worker.get();
+    }
+
+    return Result{found.load() ? 1u : 0u, search_nodes.load()};
+}
+} // end namespace details
+
+#endif //EECE_2560_PROJECTS_GRID_SEARCH_H
@@ -0,0 +1,481 @@
+/**
+ * Test executable for Project 4.
+ *
+ * Checks the Sudoku solvers against each other and against a brute-force
+ * solution counter, checks the individual deductions of the candidate grid,
+ * and checks that boards survive a read/write round trip.
+ * Puzzles are read from resources/sudoku.txt, so this executable must be run
+ * from the project 4 build directory.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "candidate_grid.h"
+#include "eece2560_thread_pool.h"
+#include "sudoku_board.h"
+#include "sudoku_entry.h"
+
+// Using anonymous namespace to give symbols internal linkage.
+namespace {
+
+/// Relative path to sudoku puzzle file.
+constexpr const char k_sudoku_file[]{"resources/sudoku.txt"};
+
+template<std::size_t N>
+using Board = SudokuBoard<N, SudokuEntry>;
+
+/// Reports the outcome of a single test case and returns whether it passed.
+bool report(const std::string& name, bool passed)
+{
+    std::cout << "Case " << name << (passed ? " OK\n" : " FAILED\n");
+    return passed;
+}
+
+/// Reads every line of the given file.
+std::vector<std::string> read_lines(const char* file_name)
+{
+    std::ifstream in(file_name);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty()) {
+            lines.push_back(line);
+        }
+    }
+    return lines;
+}
+
+/**
+ * Returns true if the given board is completely filled, every row, column,
+ * and block holds each entry once, and every cell that is not blank in
+ * `puzzle` holds the same entry.
+ */
+template<std::size_t N>
+bool is_valid_solution(const Board<N>& board, const Board<N>& puzzle)
+{
+    constexpr auto dim = Board<N>::dim();
+    for (std::size_t i{0}; i < dim; ++i) {
+        std::vector<bool> in_row(dim + 1), in_col(dim + 1), in_block(dim + 1);
+        for (std::size_t j{0}; j < dim; ++j) {
+            const auto row_entry = board.get_cell({i, j}).value;
+            const auto col_entry = board.get_cell({j, i}).value;
+            const auto block_entry = board.get_cell({N * (i / N) + j / N, N * (i % N) + j % N}).value;
+            for (const auto entry : {row_entry, col_entry, block_entry}) {
+                if (entry == 0 || entry > dim) {
+                    return false;
+                }
+            }
+            if (in_row[row_entry] || in_col[col_entry] || in_block[block_entry]) {
+                return false;
+            }
+            in_row[row_entry] = in_col[col_entry] = in_block[block_entry] = true;
+
+            const auto given = puzzle.get_cell({i, j}).value;
+            if (given != 0 && given != board.get_cell({i, j}).value) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// Counts the solutions of the given board by trying every entry in every blank cell.
+template<std::size_t N>
+std::uint64_t brute_force_count(Board<N>& board, std::size_t cell = 0)
+{
+    constexpr auto dim = Board<N>::dim();
+    while (cell < dim * dim && board.get_cell({cell / dim, cell % dim}).value != 0) {
+        ++cell;
+    }
+    if (cell == dim * dim) {
+        return 1;
+    }
+
+    std::uint64_t count{0};
+    const std::pair<std::size_t, std::size_t> coord{cell / dim, cell % dim};
+    for (SudokuEntry::Value value{1}; value <= dim; ++value) {
+        if (board.set_cell(coord, SudokuEntry{value})) {
+            count += brute_force_count(board, cell + 1);
+            board.clear_cell(coord);
+        }
+    }
+    return count;
+}
+
+/// Returns the given solved board with `blanks` random cells cleared.
+template<std::size_t N>
+std::string blank_cells(const std::string& solution, std::size_t blanks, std::mt19937& rng)
+{
+    std::string line = solution;
+    std::uniform_int_distribution<std::size_t> cell_dist(0, line.size() - 1);
+    for (std::size_t i{0}; i < blanks; ++i) {
+        line[cell_dist(rng)] = SudokuEntry::k_blank_symbol;
+    }
+    return line;
+}
+
+bool test_empty_4x4_count()
+{
+    const Board<2> board;
+    return board.count_solutions().solutions == 288 && !board.has_unique_solution();
+}
+
+bool test_count_matches_brute_force()
+{
+    // Partial 4x4 boards with zero, one, and several solutions.
+    const std::vector<std::string> small_boards{
+        "1...............",
+        "12..34..........",
+        "1..2.3..........",
+        "1234341221434321",
+        "1234341221.....1",
+        "12....1.........",
+        "1.....2..3....4.",
+    };
+    for (const auto& line : small_boards) {
+        Board<2> board;
+        board.read_line(line);
+        const auto expected = brute_force_count(board);
+        if (board.count_solutions().solutions != expected || board.line_string() != line) {
+            return false;
+        }
+    }
+
+    // 9x9 boards made by clearing random cells of a solved puzzle, so that
+    // some have several solutions.
+    const auto lines = read_lines(k_sudoku_file);
+    if (lines.empty()) {
+        return false;
+    }
+    Board<3> solved;
+    solved.read_line(lines.front());
+    solved.solve_dlx();
+
+    std::mt19937 rng(2560);
+    for (std::size_t i{0}; i < 20; ++i) {
+        Board<3> board;
+        board.read_line(blank_cells<3>(solved.line_string(), 45, rng));
+        const auto expected = brute_force_count(board);
+        if (board.count_solutions().solutions != expected
+            || board.count_solutions(2).solutions != std::min<std::uint64_t>(expected, 2)
+            || board.has_unique_solution() != (expected == 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_solvers_agree()
+{
+    const auto lines = read_lines(k_sudoku_file);
+    if (lines.empty()) {
+        return false;
+    }
+
+    using Solver = std::pair<bool, unsigned int> (Board<3>::*)();
+    const std::vector<Solver> solvers{
+        &Board<3>::solve_dlx,
+        &Board<3>::solve_propagating,
+        &Board<3>::solve_mrv,
+        &Board<3>::solve_iterative,
+    };
+    eece2560::ThreadPool pool;
+
+    for (const auto& line : lines) {
+        Board<3> puzzle;
+        puzzle.read_line(line);
+
+        Board<3> reference;
+        reference.read_line(line);
+        if (!reference.solve_dlx().first || !is_valid_solution(reference, puzzle)) {
+            return false;
+        }
+
+        for (const auto solver : solvers) {
+            Board<3> board;
+            board.read_line(line);
+            if (!(board.*solver)().first || board.line_string() != reference.line_string()) {
+                return false;
+            }
+        }
+
+        Board<3> board;
+        board.read_line(line);
+        if (!board.solve_parallel(pool).first || board.line_string() != reference.line_string()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_unsolvable_unchanged()
+{
+    // Row 0 holds 1-8 and column 8 holds a 9, so the last cell of row 0 has
+    // no candidate even though no entries conflict.
+    const std::string line{
+        "12345678."
+        "........9"
+        "........."
+        "........."
+        "........."
+        "........."
+        "........."
+        "........."
+        "........."
+    };
+
+    using Solver = std::pair<bool, unsigned int> (Board<3>::*)();
+    const std::vector<Solver> solvers{
+        &Board<3>::solve_dlx,
+        &Board<3>::solve_propagating,
+        &Board<3>::solve_mrv,
+        &Board<3>::solve_iterative,
+        &Board<3>::solve_heuristic,
+    };
+    eece2560::ThreadPool pool;
+
+    for (const auto solver : solvers) {
+        Board<3> board;
+        board.read_line(line);
+        if ((board.*solver)().first || board.line_string() != line) {
+            return false;
+        }
+    }
+
+    Board<3> board;
+    board.read_line(line);
+    return !board.solve_parallel(pool).first
+           && board.line_string() == line
+           && board.count_solutions().solutions == 0;
+}
+
+bool test_line_round_trip()
+{
+    const auto lines = read_lines(k_sudoku_file);
+    if (lines.empty()) {
+        return false;
+    }
+    for (const auto& line : lines) {
+        Board<3> board;
+        if (board.read_line(line) != line.size() || board.line_string() != line) {
+            return false;
+        }
+    }
+
+    // Entries above 9 are written as lowercase letters but read in either case.
+    const std::string hex_line{"1.3.5.7.9.b.d.f." + std::string(240, '.')};
+    Board<4> board;
+    board.read_line(hex_line);
+    if (board.line_string() != hex_line) {
+        return false;
+    }
+    board.read_line("1.3.5.7.9.B.D.F." + std::string(240, '.'));
+    return board.line_string() == hex_line;
+}
+
+/// Checks that line_string() concatenates entries written with several characters.
+bool test_multi_char_line_string()
+{
+    SudokuBoard<4> board;
+    board.set_cell({0, 0}, 16);
+    board.set_cell({0, 1}, 2);
+    return board.line_string() == "162" + std::string(254, '0');
+}
+
+/// Grid used by the propagation tests.
+using Grid = details::CandidateGrid<3>;
+
+/// Returns the candidates of every cell of the given grid.
+std::vector<Grid::Mask> candidate_snapshot(const Grid& grid)
+{
+    std::vector<Grid::Mask> snapshot;
+    for (std::size_t cell{0}; cell < Grid::k_cells; ++cell) {
+        snapshot.push_back(grid.candidates(cell));
+    }
+    return snapshot;
+}
+
+/// Returns true if the given cell has the given entry as a candidate.
+bool has_candidate(const Grid& grid, std::size_t row, std::size_t col, std::size_t entry_index)
+{
+    return (grid.candidates(Grid::cell_of(row, col)) & (Grid::Mask{1} << entry_index)) != 0;
+}
+
+bool test_hidden_single()
+{
+    // Entry 0 in rows 1-2 and columns 1-2 leaves (0, 0) as the only cell of
+    // block 0 that can take it, although the cell has other candidates.
+    Grid grid;
+    const bool assigned = grid.assign(Grid::cell_of(1, 3), 0)
+                          && grid.assign(Grid::cell_of(2, 6), 0)
+                          && grid.assign(Grid::cell_of(3, 1), 0)
+                          && grid.assign(Grid::cell_of(6, 2), 0);
+    const auto cell = Grid::cell_of(0, 0);
+    if (!assigned || grid.assigned(cell) || details::mask_popcount(grid.candidates(cell)) < 2) {
+        return false;
+    }
+    return grid.propagate() && grid.assigned(cell) && grid.value(cell) == 0;
+}
+
+bool test_pointing()
+{
+    // Filling rows 1-2 of block 0 confines entry 0 within the block to row 0,
+    // so no other cell of row 0 can take it.
+    Grid grid;
+    const std::vector<std::pair<std::size_t, std::size_t>> fills{
+        {Grid::cell_of(1, 0), 1}, {Grid::cell_of(1, 1), 2}, {Grid::cell_of(1, 2), 3},
+        {Grid::cell_of(2, 0), 4}, {Grid::cell_of(2, 1), 5}, {Grid::cell_of(2, 2), 6},
+    };
+    for (const auto&[cell, entry_index] : fills) {
+        if (!grid.assign(cell, entry_index)) {
+            return false;
+        }
+    }
+    if (!has_candidate(grid, 0, 5, 0) || !grid.propagate()) {
+        return false;
+    }
+    for (std::size_t col{3}; col < Grid::k_dim; ++col) {
+        if (has_candidate(grid, 0, col, 0)) {
+            return false;
+        }
+    }
+    return has_candidate(grid, 0, 0, 0) && has_candidate(grid, 0, 1, 0) && has_candidate(grid, 0, 2, 0);
+}
+
+bool test_claiming()
+{
+    // Filling columns 3-8 of row 0 confines entries 0, 7 and 8 within the
+    // row to block 0, so no other cell of block 0 can take them.
+    Grid grid;
+    for (std::size_t col{3}; col < Grid::k_dim; ++col) {
+        if (!grid.assign(Grid::cell_of(0, col), col - 2)) {
+            return false;
+        }
+    }
+    if (!has_candidate(grid, 1, 0, 0) || !grid.propagate()) {
+        return false;
+    }
+    for (std::size_t row{1}; row < 3; ++row) {
+        for (std::size_t col{0}; col < 3; ++col) {
+            for (const std::size_t entry_index : {0, 7, 8}) {
+                if (has_candidate(grid, row, col, entry_index)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool test_undo_restores()
+{
+    const auto lines = read_lines(k_sudoku_file);
+    if (lines.empty()) {
+        return false;
+    }
+    Board<3> puzzle;
+    puzzle.read_line(lines.front());
+
+    Grid grid;
+    for (std::size_t cell{0}; cell < Grid::k_cells; ++cell) {
+        const auto entry = puzzle.get_cell({cell / Grid::k_dim, cell % Grid::k_dim}).value;
+        if (entry != 0 && !grid.assign(cell, entry - 1)) {
+            return false;
+        }
+    }
+    grid.commit();
+    const auto before = candidate_snapshot(grid);
+    const auto mark = grid.mark();
+
+    // Guess every candidate of the best branch cell in turn, propagating and
+    // undoing each guess, and check that every undo restores the grid.
+    const auto cell = grid.branch_cell();
+    if (!cell) {
+        return false;
+    }
+    for (auto mask = grid.candidates(*cell); mask != 0; mask = details::mask_without_lowest(mask)) {
+        if (grid.assign(*cell, details::mask_lowest_index(mask))) {
+            grid.propagate();
+        }
+        grid.undo(mark);
+        if (candidate_snapshot(grid) != before || grid.assigned(*cell) || grid.solved()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Checks solve_propagating against solve_dlx on random partial boards.
+template<std::size_t N>
+bool check_propagating_matches_dlx(std::size_t board_count, std::size_t blanks, std::mt19937& rng)
+{
+    // Solving the empty board gives a full grid to clear cells from.
+    Board<N> solved;
+    solved.solve_dlx();
+
+    for (std::size_t i{0}; i < board_count; ++i) {
+        Board<N> puzzle;
+        auto line = blank_cells<N>(solved.line_string(), blanks, rng);
+        // Change a few of the remaining entries, so that some boards have
+        // no solution.
+        std::uniform_int_distribution<std::size_t> cell_dist(0, line.size() - 1);
+        for (std::size_t j{0}; j < i % 3; ++j) {
+            auto& symbol = line[cell_dist(rng)];
+            if (symbol != SudokuEntry::k_blank_symbol) {
+                symbol = solved.line_string()[cell_dist(rng)];
+            }
+        }
+        puzzle.read_line(line);
+
+        Board<N> by_dlx;
+        by_dlx.read_line(line);
+        Board<N> by_propagation;
+        by_propagation.read_line(line);
+
+        const bool dlx_solved = by_dlx.solve_dlx().first;
+        if (by_propagation.solve_propagating().first != dlx_solved) {
+            return false;
+        }
+        if (dlx_solved && !is_valid_solution(by_propagation, puzzle)) {
+            return false;
+        }
+        if (!dlx_solved && by_propagation.line_string() != puzzle.line_string()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_propagating_matches_dlx()
+{
+    std::mt19937 rng(2560);
+    return check_propagating_matches_dlx<3>(200, 55, rng) && check_propagating_matches_dlx<4>(20, 160, rng);
+}
+
+} // end namespace
+
+int main()
+{
+    bool passed{true};
+    passed &= report("empty 4x4 board has 288 solutions", test_empty_4x4_count());
+    passed &= report("count_solutions matches brute force", test_count_matches_brute_force());
+    passed &= report("solvers agree on " + std::string(k_sudoku_file), test_solvers_agree());
+    passed &= report("unsolvable board is left unchanged", test_unsolvable_unchanged());
+    passed &= report("read_line/line_string round trip", test_line_round_trip());
+    passed &= report("line_string with multi-character entries", test_multi_char_line_string());
+    passed &= report("propagation finds hidden singles", test_hidden_single());
+    passed &= report("propagation removes pointing candidates", test_pointing());
+    passed &= report("propagation removes claiming candidates", test_claiming());
+    passed &= report("undo restores the candidate grid", test_undo_restores());
+    passed &= report("solve_propagating agrees with solve_dlx", test_propagating_matches_dlx());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
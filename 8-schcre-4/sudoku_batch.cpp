@@ -0,0 +1,244 @@
+/**
+ * Project 4 parallel batch solver.
+ *
+ * Reads Sudoku puzzles, one per line, and solves them on a thread pool. Each
+ * worker owns a single board, which it reuses for every puzzle it claims.
+ * Workers claim small runs of puzzles from a shared counter, so a worker that
+ * finishes its easy puzzles early simply claims more instead of idling.
+ *
+ * One line is written to standard output per puzzle, in input order: the
+ * solution if one exists, and otherwise the puzzle as read. Throughput and call
+ * count statistics are written to standard error.
+ *
+ * Usage: 8-schcre-4-batch [puzzle_file] [threads] [solver] [box_size]
+ *
+ * where solver is one of iterative (default), propagating, dlx, mrv, or heuristic,
+ * and box_size is 3 for 9x9 puzzles (default) or 4 for 16x16 puzzles.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#include <algorithm>        // for std::min
+#include <atomic>           // for std::atomic
+#include <chrono>           // for std::chrono::steady_clock
+#include <cstdlib>          // for std::strtoull, EXIT_FAILURE
+#include <fstream>          // for std::ifstream
+#include <future>           // for std::future
+#include <iomanip>          // for I/O stream manipulators
+#include <iostream>         // for I/O stream definitions
+#include <memory>           // for std::unique_ptr, std::make_unique
+#include <string>           // for std::string, std::getline
+#include <string_view>      // for std::string_view
+#include <thread>           // for std::thread
+#include <vector>           // for std::vector
+
+#include "call_statistics.h"
+#include "eece2560_thread_pool.h"
+#include "sudoku_board.h"
+#include "sudoku_entry.h"
+
+namespace {
+/// Relative path to the default sudoku puzzle file.
+constexpr const char k_default_sudoku_file[]{"resources/sudoku.txt"};
+
+/// The number of puzzles read, solved, and written at a time. Bounds the
+/// memory used for the puzzle lines and output of arbitrarily large puzzle
+/// files. The call count of every puzzle is still kept until the end of the
+/// run to compute the median.
+constexpr std::size_t k_batch_size{1u << 16};
+
+/// The number of consecutive puzzles claimed by a worker at a time.
+constexpr std::size_t k_claim_size{64};
+
+template<std::size_t N>
+using Board = SudokuBoard<N, SudokuEntry>;
+
+/// Pointer to one of the SudokuBoard solvers.
+template<std::size_t N>
+using Solver = decltype(&Board<N>::solve_iterative);
+
+/// Returns the solver with the given name, or nullptr if there is none.
+template<std::size_t N>
+Solver<N> solver_named(std::string_view name)
+{
+    if (name == "iterative") {
+        return &Board<N>::solve_iterative;
+    } else if (name == "propagating") {
+        return &Board<N>::solve_propagating;
+    } else if (name == "dlx") {
+        return &Board<N>::solve_dlx;
+    } else if (name == "mrv") {
+        return &Board<N>::solve_mrv;
+    } else if (name == "heuristic") {
+        return &Board<N>::solve_heuristic;
+    }
+    return nullptr;
+}
+
+/// The number of characters written for each puzzle, including the line break.
+template<std::size_t N>
+constexpr std::size_t k_output_line_length{Board<N>::line_length() + 1};
+
+/// The result of solving one puzzle.
+struct Outcome {
+    bool solved;
+    unsigned long call_count;
+};
+
+/**
+ * Solves the given puzzles on the thread pool, with one board per worker.
+ *
+ * @param puzzles Puzzle lines to be solved.
+ * @param count Number of leading puzzles to solve.
+ * @param outcomes Receives the outcome of each puzzle at the same index.
+ * @param output Receives the output line of each puzzle, at a multiple of
+ *               k_output_line_length given by its index.
+ */
+template<std::size_t N>
+void solve_batch(
+    const std::vector<std::string>& puzzles,
+    std::size_t count,
+    std::vector<Outcome>& outcomes,
+    std::vector<char>& output,
+    std::vector<std::unique_ptr<Board<N>>>& boards,
+    Solver<N> solver,
+    eece2560::ThreadPool& pool)
+{
+    std::atomic<std::size_t> next_puzzle{0};
+
+    std::vector<std::future<void>> workers;
+    workers.reserve(boards.size());
+    for (auto& board : boards) {
+        workers.push_back(pool.submit([&, board = board.get()]() {
+            while (true) {
+                const auto first = next_puzzle.fetch_add(k_claim_size, std::memory_order_relaxed);
+                if (first >= count) {
+                    return;
+                }
+                const auto last = std::min(first + k_claim_size, count);
+                for (auto i = first; i < last; ++i) {
+                    board->read_line(puzzles[i]);
+                    const auto[solved, call_count] = (board->*solver)();
+                    outcomes[i] = Outcome{solved, call_count};
+
+                    auto* const line = output.data() + i * k_output_line_length<N>;
+                    *board->write_line(line) = '\n';
+                }
+            }
+        }));
+    }
+
+    // Wait for every worker before rethrowing any exception, since the workers
+    // refer to this function's locals.
+    for (auto& worker : workers) {
+        worker.wait();
+    }
+    for (auto& worker : workers) {
+        worker.get();
+    }
+}
+
+/**
+ * Solves every puzzle in the given file with boards of the given size, writing
+ * the results to standard output and the statistics to standard error.
+ *
+ * @tparam N Characteristic board size.
+ * @return Exit status of the program.
+ */
+template<std::size_t N>
+int solve_puzzles(const char* puzzle_path, std::string_view solver_name, std::size_t thread_count)
+{
+    const auto solver = solver_named<N>(solver_name);
+    if (!solver) {
+        std::cerr << "Unknown solver '" << solver_name << "'\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream file_in(puzzle_path);
+    if (!file_in) {
+        std::cerr << "Unable to open puzzle file '" << puzzle_path << "'\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    eece2560::ThreadPool pool(thread_count);
+    std::vector<std::unique_ptr<Board<N>>> boards;
+    for (std::size_t i{0}; i < pool.size(); ++i) {
+        boards.push_back(std::make_unique<Board<N>>());
+    }
+
+    // Puzzle, outcome, and output storage is reused across batches.
+    std::vector<std::string> puzzles(k_batch_size);
+    std::vector<Outcome> outcomes(k_batch_size);
+    std::vector<char> output(k_batch_size * k_output_line_length<N>);
+    std::vector<unsigned long> board_call_counts;
+    std::size_t solved_count{0};
+
+    while (file_in) {
+        std::size_t count{0};
+        while (count < k_batch_size && std::getline(file_in, puzzles[count])) {
+            ++count;
+        }
+        if (count == 0) {
+            break;
+        }
+
+        solve_batch(puzzles, count, outcomes, output, boards, solver, pool);
+
+        std::cout.write(output.data(), static_cast<std::streamsize>(count * k_output_line_length<N>));
+        for (std::size_t i{0}; i < count; ++i) {
+            solved_count += outcomes[i].solved ? 1 : 0;
+            board_call_counts.push_back(outcomes[i].call_count);
+        }
+    }
+    std::cout.flush();
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    const auto board_count = board_call_counts.size();
+    if (board_count == 0) {
+        std::cerr << "No puzzles read.\n";
+        return EXIT_SUCCESS;
+    }
+
+    const auto[median, average] = call_statistics(board_call_counts);
+
+    std::cerr << std::fixed << std::setprecision(0)
+              << "Puzzles solved:    " << std::setw(8) << solved_count << " of " << board_count << '\n'
+              << "Threads:           " << std::setw(8) << pool.size() << '\n'
+              << "Elapsed seconds:   " << std::setw(12) << std::setprecision(3) << elapsed.count() << '\n'
+              << "Puzzles/s:         " << std::setw(11) << std::setprecision(2)
+              << static_cast<double>(board_count) / elapsed.count() << '\n'
+              << std::setprecision(0)
+              << "Median calls made: " << std::setw(8) << median << '\n'
+              << "Avg. calls made:   " << std::setw(8) << average << '\n';
+
+    return EXIT_SUCCESS;
+}
+
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+    const char* const puzzle_path = argc > 1 ? argv[1] : k_default_sudoku_file;
+    const std::size_t thread_count = argc > 2
+        ? static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10))
+        : std::thread::hardware_concurrency();
+    const std::string_view solver_name = argc > 3 ? argv[3] : "iterative";
+    const auto box_size = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 3;
+
+    std::ios::sync_with_stdio(false);
+
+    switch (box_size) {
+        case 3:
+            return solve_puzzles<3>(puzzle_path, solver_name, thread_count);
+        case 4:
+            return solve_puzzles<4>(puzzle_path, solver_name, thread_count);
+        default:
+            std::cerr << "Unsupported box size " << box_size << "; expected 3 or 4\n";
+            return EXIT_FAILURE;
+    }
+}
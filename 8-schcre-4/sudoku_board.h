@@ -11,6 +11,7 @@
  *  [2] https://stackoverflow.com/questions/64794809/#64794991
  *  [3] https://en.cppreference.com/w/cpp/iterator/istream_iterator
  *  [4] https://en.cppreference.com/w/cpp/named_req/Container
+ *  [5] https://en.wikipedia.org/wiki/Exact_cover#Sudoku
  */
 
 #ifndef EECE_2560_PROJECTS_SUDOKU_BOARD_H
@@ -18,15 +19,25 @@
 
 #include <algorithm>        // for std::random_shuffle
 #include <array>            // for std::array
+#include <cctype>           // for std::isspace
 #include <cstddef>          // for std::size_t
+#include <cstdint>          // for std::uint8_t, std::uint16_t
 #include <iostream>         // for I/O stream definitions
 #include <limits>           // for std::numeric_limits
 #include <memory>           // for std::unique_ptr
 #include <numeric>          // for std::iota
 #include <optional>         // for std::optional
+#include <sstream>          // for std::stringstream, std::ostringstream
+#include <stdexcept>        // for std::logic_error
+#include <string>           // for std::string
+#include <string_view>      // for std::string_view
 #include <type_traits>      // for std::is_integral
+#include <vector>           // for std::vector
 
+#include "candidate_grid.h"
+#include "dancing_links.h"
 #include "eece2560_io.h"
+#include "grid_search.h"
 #include "matrix.h"
 
 namespace details {
@@ -69,6 +80,19 @@ std::optional<T> iterate_optional_until(T initial_value, F func = F(), P pred =
  */
 template<std::size_t N>
 struct BoardConflicts;
+
+/**
+ * The blank cells of a Sudoku board, grouped by their number of candidates.
+ */
+template<std::size_t N>
+class CandidateBuckets;
+
+/**
+ * Lookup tables between the entries of a Sudoku board and the characters
+ * used to represent them.
+ */
+template<typename Entry, typename Policy, std::size_t N>
+struct EntrySymbols;
 } // end namespace details
 
 /**
@@ -98,7 +122,7 @@ struct SudokuEntryPolicy {
     /**
      * Returns the entry associated with the given index.
      */
-    constexpr T reverse_index(std::size_t index) const { return index + 1; }
+    constexpr T reverse_index(std::size_t index) const { return static_cast<T>(index + 1); }
 
     /**
      * Returns true if the given entry is a legal value for a board with the
@@ -130,6 +154,15 @@ class SudokuBoard {
 
     using Conflicts = details::BoardConflicts<k_dim>;
 
+    /// Candidate tracker used by the propagating solvers.
+    using CandidateGrid = details::CandidateGrid<N>;
+
+    /// Candidate count buckets used by the MRV solver.
+    using CandidateBuckets = details::CandidateBuckets<k_dim>;
+
+    /// Character lookup tables used to read and write boards.
+    using EntrySymbols = details::EntrySymbols<Entry, Policy, k_dim>;
+
     /// The type used to index cell on this Sudoku board.
     using Coordinate = typename Board::Coordinate;
 
@@ -151,8 +184,18 @@ class SudokuBoard {
     /// The cell entries for this Sudoku board.
     const std::unique_ptr<Board> m_board_entries{new Board{}};
 
+    /**
+     * The blank cells of this board, bucketed by their number of candidates.
+     *
+     * Only maintained while solve_mrv() is running, and null otherwise.
+     */
+    std::unique_ptr<CandidateBuckets> m_candidate_buckets;
+
   public:
 
+    /// Solution count and search statistics reported by count_solutions().
+    using SolutionCount = typename details::GridSearch<N>::Result;
+
     /// Create a Sudoku board with an empty board.
     explicit SudokuBoard(Policy policy = Policy())
         : m_entry_policy(std::move(policy)) {};
@@ -182,6 +225,9 @@ class SudokuBoard {
     /// Returns the number of rows / number of columns on this Sudoku board.
     constexpr static std::size_t dim() { return k_dim; }
 
+    /// Returns the entry in the cell at the given coordinate.
+    [[nodiscard]] Entry get_cell(Coordinate coord) const { return (*m_board_entries)[coord]; }
+
     /**
      * Sets the cell at the given index to the given entry and updates the
      * conflict tables accordingly.
@@ -214,6 +260,8 @@ class SudokuBoard {
         // Add the row, column, and block conflicts for the new entry.
         set_conflict_state(coord, entry, true);
 
+        refresh_candidate_counts(coord);
+
         return true;
     }
 
@@ -235,6 +283,8 @@ class SudokuBoard {
             set_conflict_state(coord, cell, false);
             // Set the entry at the specified coordinate to a blank value.
             cell = m_entry_policy.blank_sentinel;
+
+            refresh_candidate_counts(coord);
         }
     }
 
@@ -245,14 +295,8 @@ class SudokuBoard {
     {
         // Fill the Sudoku board with blank entries.
         std::fill(std::begin(*m_board_entries), std::end(*m_board_entries), m_entry_policy.blank_sentinel);
-        // Set all of the conflict tables to all false. [2]
-        for (auto conflict_table : {
-            std::ref(m_conflicts->rows.table),
-            std::ref(m_conflicts->cols.table),
-            std::ref(m_conflicts->blocks.table)
-        }) {
-            std::fill(std::begin(conflict_table.get()), std::end(conflict_table.get()), false);
-        }
+        // Remove all conflicts.
+        *m_conflicts = Conflicts{};
     }
 
     /**
@@ -265,7 +309,7 @@ class SudokuBoard {
      */
     std::pair<bool, CallCount> solve_scanning_row()
     {
-        const static auto find_next_row = [&](Coordinate coord) {
+        const auto find_next_row = [&](Coordinate coord) {
             return details::iterate_optional_until(coord, step_row, [&](Coordinate c) {
                 return ((*m_board_entries)[c] == m_entry_policy.blank_sentinel);
             });
@@ -289,7 +333,7 @@ class SudokuBoard {
      */
     std::pair<bool, CallCount> solve_scanning_col()
     {
-        const static auto find_next_col = [&](Coordinate coord) -> std::optional<Coordinate> {
+        const auto find_next_col = [&](Coordinate coord) -> std::optional<Coordinate> {
             return details::iterate_optional_until(coord, step_col, [&](Coordinate c) {
                 return ((*m_board_entries)[c] == m_entry_policy.blank_sentinel);
             });
@@ -313,7 +357,7 @@ class SudokuBoard {
     */
     std::pair<bool, CallCount> solve_scanning_block()
     {
-        const static auto find_next_block = [&](Coordinate coord) -> std::optional<Coordinate> {
+        const auto find_next_block = [&](Coordinate coord) -> std::optional<Coordinate> {
             return details::iterate_optional_until(coord, step_block, [&](Coordinate c) {
                 return ((*m_board_entries)[c] == m_entry_policy.blank_sentinel);
             });
@@ -337,7 +381,7 @@ class SudokuBoard {
      */
     std::pair<bool, CallCount> solve_heuristic()
     {
-        const static auto guess_next = [&](auto) -> std::optional<Coordinate> {
+        const auto guess_next = [&](auto) -> std::optional<Coordinate> {
             const auto best_row = m_conflicts->promising_index(&Conflicts::rows);
             const auto best_col = m_conflicts->promising_index(&Conflicts::cols);
 
@@ -365,6 +409,254 @@ class SudokuBoard {
         return solve_after(*start, guess_next);
     }
 
+    /**
+     * Attempts to solve this Sudoku board, always filling the blank cell with
+     * the fewest legal candidates next (the minimum remaining values
+     * heuristic). Returns a pair containing 0) a bool indicating whether the
+     * board was successfully solved, and 1) the number of recursive function
+     * calls required to determine the solution.
+     *
+     * While this solver runs, the blank cells are kept in buckets by their
+     * number of candidates, which are updated for the peers of each cell that
+     * is filled or cleared. The next cell is then taken from the lowest
+     * non-empty bucket without scanning the board.
+     *
+     * @return Pair of 0) whether the board was solved, 1) the number of
+     *         recursive calls made to find the solution.
+     */
+    std::pair<bool, CallCount> solve_mrv()
+    {
+        m_candidate_buckets = std::make_unique<CandidateBuckets>();
+        for (std::size_t cell{0}; cell < k_dim * k_dim; ++cell) {
+            if ((*m_board_entries)[cell] == m_entry_policy.blank_sentinel) {
+                m_candidate_buckets->update(cell, details::mask_popcount(candidate_mask({cell / k_dim, cell % k_dim})));
+            }
+        }
+
+        const auto find_fewest_candidates = [this](Coordinate) -> std::optional<Coordinate> {
+            const auto cell = m_candidate_buckets->minimum();
+            if (!cell) {
+                // The board is filled.
+                return std::nullopt;
+            }
+            return {{*cell / k_dim, *cell % k_dim}};
+        };
+
+        std::pair<bool, CallCount> result{true, 0};
+        if (const auto start = find_fewest_candidates(Coordinate{})) {
+            result = solve_after(*start, find_fewest_candidates);
+        }
+        m_candidate_buckets.reset();
+        return result;
+    }
+
+    /**
+     * Attempts to solve this Sudoku board by reducing it to an exact cover
+     * problem [5] that is solved with dancing links. Returns a pair
+     * containing 0) a bool indicating whether the board was successfully
+     * solved, and 1) the number of search nodes visited to find the solution.
+     *
+     * Every blank cell must receive one entry, and every entry missing from a
+     * row, column, or block must be placed exactly once in it. Each candidate
+     * entry for a blank cell covers one of each of these constraints.
+     *
+     * @return Pair of 0) whether the board was solved, 1) the number of
+     *         search nodes visited to find the solution.
+     */
+    std::pair<bool, CallCount> solve_dlx()
+    {
+        using Index = DancingLinks::Index;
+
+        // Constraints are numbered cell, row-entry, column-entry, then block-entry.
+        constexpr std::size_t k_constraint_count{4 * k_dim * k_dim};
+        constexpr Index k_satisfied{std::numeric_limits<Index>::max()};
+
+        // Assign a column to each constraint that the given entries do not
+        // already satisfy.
+        std::vector<Index> constraint_columns(k_constraint_count, k_satisfied);
+        Index column_count{0};
+        const auto assign = [&](std::size_t constraint, bool satisfied) {
+            if (!satisfied) {
+                constraint_columns[constraint] = column_count;
+                ++column_count;
+            }
+        };
+        for (std::size_t i{0}; i < k_dim; ++i) {
+            for (std::size_t j{0}; j < k_dim; ++j) {
+                const auto bit = Conflicts::bit_of(j);
+                assign(i * k_dim + j, (*m_board_entries)[i * k_dim + j] != m_entry_policy.blank_sentinel);
+                assign((k_dim + i) * k_dim + j, (m_conflicts->rows[i] & bit) != 0);
+                assign((2 * k_dim + i) * k_dim + j, (m_conflicts->cols[i] & bit) != 0);
+                assign((3 * k_dim + i) * k_dim + j, (m_conflicts->blocks[i] & bit) != 0);
+            }
+        }
+
+        if (column_count == 0) {
+            // The board is already solved.
+            return {true, 0};
+        }
+
+        // Add one row for each candidate entry of each blank cell.
+        DancingLinks links(column_count);
+        for (std::size_t cell{0}; cell < k_dim * k_dim; ++cell) {
+            if ((*m_board_entries)[cell] != m_entry_policy.blank_sentinel) {
+                continue;
+            }
+            const Coordinate coord{cell / k_dim, cell % k_dim};
+            const auto block = block_index(coord);
+            for (auto mask = candidate_mask(coord); mask != 0; mask = details::mask_without_lowest(mask)) {
+                const auto entry_index = details::mask_lowest_index(mask);
+                const std::array<Index, 4> columns{
+                    constraint_columns[cell],
+                    constraint_columns[(k_dim + coord.first) * k_dim + entry_index],
+                    constraint_columns[(2 * k_dim + coord.second) * k_dim + entry_index],
+                    constraint_columns[(3 * k_dim + block) * k_dim + entry_index],
+                };
+                links.add_row(static_cast<Index>(cell * k_dim + entry_index), std::begin(columns), std::end(columns));
+            }
+        }
+
+        const bool solved = links.search(1) == 1;
+        if (solved) {
+            for (const auto row : links.solution()) {
+                set_cell({row / k_dim / k_dim, row / k_dim % k_dim}, m_entry_policy.reverse_index(row % k_dim));
+            }
+        }
+        return {solved, static_cast<CallCount>(links.call_count())};
+    }
+
+    /**
+     * Attempts to solve this Sudoku board by constraint propagation with
+     * backtracking. Returns a pair containing 0) a bool indicating whether the
+     * board was successfully solved, and 1) the number of search nodes visited
+     * to find the solution.
+     *
+     * Naked singles, hidden singles, and locked candidates are deduced before
+     * the search begins and again after every guess, so most boards need few
+     * or no guesses. Guesses are made in the cell with the fewest candidates.
+     *
+     * @return Pair of 0) whether the board was solved, 1) the number of
+     *         search nodes visited to find the solution.
+     */
+    std::pair<bool, CallCount> solve_propagating()
+    {
+        if (is_solved()) {
+            return {true, 0};
+        }
+
+        CandidateGrid grid;
+        CallCount call_count{0};
+        const bool solved = load_candidates(grid) && grid.propagate() && search_propagating(grid, call_count);
+        if (solved) {
+            store_candidates(grid);
+        }
+        return {solved, call_count};
+    }
+
+    /**
+     * Attempts to solve this Sudoku board with the same propagation and
+     * guesses as solve_propagating(), but without recursion. Returns a pair
+     * containing 0) a bool indicating whether the board was successfully
+     * solved, and 1) the number of search nodes visited to find the solution.
+     *
+     * The search keeps its guesses on an explicit stack allocated once, and
+     * backtracks through the undo trail of the candidate grid, so it performs
+     * no sorting or allocation per node and its depth is not limited by the
+     * call stack. This makes it suitable for large boards.
+     *
+     * @return Pair of 0) whether the board was solved, 1) the number of
+     *         search nodes visited to find the solution.
+     */
+    std::pair<bool, CallCount> solve_iterative()
+    {
+        if (is_solved()) {
+            return {true, 0};
+        }
+
+        CandidateGrid grid;
+        if (!load_candidates(grid) || !grid.propagate()) {
+            return {false, 0};
+        }
+
+        details::GridSearch<N> search;
+        const auto result = search.run(grid, 1, [](const CandidateGrid&) {});
+        if (result.solutions > 0) {
+            store_candidates(grid);
+        }
+        return {result.solutions > 0, static_cast<CallCount>(result.nodes)};
+    }
+
+    /**
+     * Attempts to solve this Sudoku board with the same propagation and
+     * guesses as solve_iterative(), searching independent subtrees in
+     * parallel on the given thread pool. Returns a pair containing 0) a bool
+     * indicating whether the board was successfully solved, and 1) the total
+     * number of search nodes visited by all workers.
+     *
+     * Each worker searches its own copy of the candidate grid, and the board
+     * itself is only updated once a solution is found. When the board has
+     * several solutions, the one found first by any worker is kept, so the
+     * result and call count may vary between runs.
+     *
+     * This function waits on the pool, so it must not be called from one of
+     * the pool's own tasks.
+     *
+     * @param pool Thread pool that runs the subtree searches.
+     * @return Pair of 0) whether the board was solved, 1) the number of
+     *         search nodes visited to find the solution.
+     */
+    std::pair<bool, CallCount> solve_parallel(eece2560::ThreadPool& pool)
+    {
+        if (is_solved()) {
+            return {true, 0};
+        }
+
+        CandidateGrid grid;
+        if (!load_candidates(grid) || !grid.propagate()) {
+            return {false, 0};
+        }
+
+        const auto result = details::parallel_grid_search(grid, pool);
+        if (result.solutions > 0) {
+            store_candidates(grid);
+        }
+        return {result.solutions > 0, static_cast<CallCount>(result.nodes)};
+    }
+
+    /**
+     * Counts the solutions of this Sudoku board without modifying it, using
+     * the same propagation and guesses as solve_iterative().
+     *
+     * The whole search space is explored unless `limit` solutions are found
+     * first, in which case the search stops early. A limit of 2 is sufficient
+     * to determine whether the board has a unique solution.
+     *
+     * @param limit Number of solutions after which counting stops.
+     * @return The number of solutions found, which is at most `limit`, and
+     *         the number of search nodes visited.
+     */
+    [[nodiscard]] SolutionCount count_solutions(
+        std::uint64_t limit = std::numeric_limits<std::uint64_t>::max()) const
+    {
+        if (limit == 0) {
+            return SolutionCount{0, 0};
+        }
+        if (is_solved()) {
+            return SolutionCount{1, 0};
+        }
+
+        CandidateGrid grid;
+        if (!load_candidates(grid) || !grid.propagate()) {
+            return SolutionCount{0, 0};
+        }
+
+        details::GridSearch<N> search;
+        return search.run(grid, limit, [](const CandidateGrid&) {});
+    }
+
+    /// Returns true if this Sudoku board has exactly one solution.
+    [[nodiscard]] bool has_unique_solution() const { return count_solutions(2).solutions == 1; }
+
     /**
      * Generates a string representing this Sudoku board.
      *
@@ -376,33 +668,122 @@ class SudokuBoard {
         // Make sure the counter technique used below won't overflow.
         static_assert(k_dim * k_dim <= std::numeric_limits<Counter>::max());
 
-        std::ostringstream stream;
+        const auto& symbols = entry_symbols().symbols;
+        const std::string divider(2 * (k_dim + N) + 1, '-');
+
+        // Each row holds its entries, the spaces after them, and its
+        // vertical dividers. Every N-th row is followed by a horizontal divider.
+        std::string result;
+        result.reserve(k_dim * (2 * k_dim + 2 * N + 4) + N * (divider.size() + 1));
         Counter entry_counter{0};
 
         for (auto entry : *m_board_entries) {
             // Check if the current entry precedes a horizontal-block boundary.
             if (entry_counter % N == 0) {
-                stream << "| ";     // Write a vertical divider.
+                result += "| ";     // Write a vertical divider.
             }
 
             if (entry_counter != 0) {
                 // Check if the current entry precedes a vertical-block boundary
                 if (entry_counter % (k_dim * N) == 0) {
                     // Write a horizontal divider with the width of a full row.
-                    stream << '\n' << std::string(2 * (k_dim + N) + 1, '-');
+                    result += '\n';
+                    result += divider;
                 }
 
                 // Check if the current entry is the end of a row.
                 if (entry_counter % k_dim == 0) {
-                    stream << '\n' << "| ";
+                    result += "\n| ";
                 }
             }
-            stream << entry << ' ';
+            result += symbols[symbol_index(entry)];
+            result += ' ';
             ++entry_counter;
         }
-        stream << "|\n";
+        result += "|\n";
+
+        return result;
+    }
+
+    /// Returns the number of characters written by write_line().
+    constexpr static std::size_t line_length() { return k_dim * k_dim; }
+
+    /**
+     * Writes the entries of this Sudoku board into the given buffer in
+     * row-major order, in the same format read by read_line(). Exactly
+     * line_length() characters are written, with no line break or terminator.
+     *
+     * Every entry must be represented by a single character.
+     *
+     * @param out Buffer with room for at least line_length() characters.
+     * @return Pointer one past the last character written.
+     * @throws std::logic_error if an entry is not represented by a single character.
+     */
+    char* write_line(char* out) const
+    {
+        const auto& symbols = entry_symbols();
+        if (!symbols.single_char) {
+            throw std::logic_error("sudoku entries are not single characters");
+        }
+
+        for (auto entry : *m_board_entries) {
+            *out = symbols.symbols[symbol_index(entry)].front();
+            ++out;
+        }
+        return out;
+    }
+
+    /**
+     * Generates a single-line string containing the entries of this Sudoku
+     * board in row-major order, in the same format read by operator>>.
+     *
+     * Entries that are represented by several characters are concatenated
+     * as-is, so such a line cannot be read back unambiguously.
+     *
+     * @return Board entries with no separators or line break.
+     */
+    [[nodiscard]] std::string line_string() const
+    {
+        const auto& symbols = entry_symbols();
+        if (!symbols.single_char) {
+            std::string line;
+            for (auto entry : *m_board_entries) {
+                line += symbols.symbols[symbol_index(entry)];
+            }
+            return line;
+        }
+
+        std::string line(line_length(), '\0');
+        write_line(line.data());
+        return line;
+    }
+
+    /**
+     * Replaces the entries of this Sudoku board with those read from the
+     * given characters, using the same rules as operator>>: whitespace is
+     * skipped, every other character fills the next cell, and unknown symbols
+     * or illegal entries leave that cell blank. Cells left over when the
+     * characters run out are also blank.
+     *
+     * Each character is converted with a lookup table rather than a stream,
+     * so no memory is allocated.
+     *
+     * @param line Characters to be read.
+     * @return The number of characters consumed, which stops short of the
+     *         end of the line once every cell has been filled.
+     */
+    std::size_t read_line(std::string_view line)
+    {
+        clear();
 
-        return stream.str();
+        std::size_t cell{0};
+        std::size_t pos{0};
+        for (; pos < line.size() && cell < k_dim * k_dim; ++pos) {
+            if (read_symbol(cell, line[pos])) {
+                ++cell;
+            }
+        }
+        return pos;
     }
 
 #ifdef EECE2560_PART_A_DEMO
@@ -433,12 +814,18 @@ class SudokuBoard {
      * @return True if the cell has no conflicts for the entry.
      */
     bool check_legal_move(Coordinate coord, Entry entry)
+    {
+        return (candidate_mask(coord) & Conflicts::bit_of(m_entry_policy.index_of(entry))) != 0;
+    }
+
+    /**
+     * Returns a mask with bit i set if and only if the entry with index i has
+     * no conflicts in the row, column, or block of the given cell.
+     */
+    typename Conflicts::Mask candidate_mask(Coordinate coord) const
     {
         const auto[row, col] = coord;
-        const auto entry_index = m_entry_policy.index_of(entry);
-        return !m_conflicts->check_source(&Conflicts::rows, row, entry_index)
-            && !m_conflicts->check_source(&Conflicts::cols, col, entry_index)
-            && !m_conflicts->check_source(&Conflicts::blocks, block_index(coord), entry_index);
+        return m_conflicts->candidates(row, col, block_index(coord));
     }
 
     /**
@@ -475,21 +862,24 @@ class SudokuBoard {
 
         CallCount call_count{1u};
 
-        // Generate an array of all entry indices
-        auto m_entry_indices = []() {
-            std::array<typename Conflicts::Index, k_dim> temp;
-            std::iota(std::begin(temp), std::end(temp), 0);
-            return temp;
-        }();
+        // Collect the indices of the entries that have no conflicts at coord,
+        // in increasing order, by repeatedly extracting the lowest set bit.
+        std::array<typename Conflicts::Index, k_dim> m_entry_indices;
+        std::size_t candidate_count{0};
+        for (auto mask = candidate_mask(coord); mask != 0; mask = details::mask_without_lowest(mask)) {
+            m_entry_indices[candidate_count] = details::mask_lowest_index(mask);
+            ++candidate_count;
+        }
+        const auto candidates_end = std::begin(m_entry_indices) + static_cast<std::ptrdiff_t>(candidate_count);
 
         // Sort the entry indices based on the number of times each entry appears in the board.
-        std::sort(std::begin(m_entry_indices), std::end(m_entry_indices), [&](auto lhs, auto rhs) {
+        std::sort(std::begin(m_entry_indices), candidates_end, [&](auto lhs, auto rhs) {
             return m_conflicts->entry_counts[lhs] < m_conflicts->entry_counts[rhs];
         });
 
-
-        // Iterate over the k_dim conflict table indices to find entry candidates.
-        for (const auto index : m_entry_indices) {
+        // Iterate over the legal entry candidates only.
+        for (auto it = std::begin(m_entry_indices); it != candidates_end; ++it) {
+            const auto index = *it;
             // Attempt set the cell at coord with the value associated with index.
             // set_cell returns false if the candidate value has a conflict.
             if (set_cell(coord, m_entry_policy.reverse_index(index))) {
@@ -517,6 +907,95 @@ class SudokuBoard {
         return {false, call_count};
     }
 
+    /**
+     * Updates the candidate counts of the given cell and its peers after the
+     * cell has been filled or cleared, if solve_mrv() is running.
+     */
+    void refresh_candidate_counts(Coordinate coord)
+    {
+        if (!m_candidate_buckets) {
+            return;
+        }
+
+        const auto refresh = [&](Coordinate peer) {
+            const auto cell = peer.first * k_dim + peer.second;
+            if ((*m_board_entries)[cell] == m_entry_policy.blank_sentinel) {
+                m_candidate_buckets->update(cell, details::mask_popcount(candidate_mask(peer)));
+            } else {
+                m_candidate_buckets->remove(cell);
+            }
+        };
+
+        const auto[row, col] = coord;
+        const auto block_row = N * (row / N);
+        const auto block_col = N * (col / N);
+        for (std::size_t i{0}; i < k_dim; ++i) {
+            refresh({row, i});
+            refresh({i, col});
+            refresh({block_row + i / N, block_col + i % N});
+        }
+    }
+
+    /**
+     * Assigns the entries of this board to the given grid, which must have no
+     * assignments.
+     *
+     * @return false if the entries leave the grid in a contradiction.
+     */
+    bool load_candidates(CandidateGrid& grid) const
+    {
+        for (std::size_t cell{0}; cell < k_dim * k_dim; ++cell) {
+            const auto entry = (*m_board_entries)[cell];
+            if (entry != m_entry_policy.blank_sentinel && !grid.assign(cell, m_entry_policy.index_of(entry))) {
+                return false;
+            }
+        }
+        grid.commit();
+        return true;
+    }
+
+    /// Copies the assigned cells of the given grid into the blank cells of this board.
+    void store_candidates(const CandidateGrid& grid)
+    {
+        for (std::size_t cell{0}; cell < k_dim * k_dim; ++cell) {
+            if (grid.assigned(cell) && (*m_board_entries)[cell] == m_entry_policy.blank_sentinel) {
+                set_cell({cell / k_dim, cell % k_dim}, m_entry_policy.reverse_index(grid.value(cell)));
+            }
+        }
+    }
+
+    /**
+     * Searches for a solution of the given propagated grid, guessing each
+     * candidate of the cell with the fewest candidates in turn.
+     *
+     * @param grid Grid to be solved. On success, the grid holds the solution.
+     *             Otherwise, the grid is left unchanged.
+     * @param call_count Incremented once per search node.
+     * @return true if a solution was found.
+     */
+    static bool search_propagating(CandidateGrid& grid, CallCount& call_count)
+    {
+        ++call_count;
+
+        const auto cell = grid.branch_cell();
+        if (!cell) {
+            // Every cell has been assigned.
+            return true;
+        }
+
+        for (auto mask = grid.candidates(*cell); mask != 0; mask = details::mask_without_lowest(mask)) {
+            const auto mark = grid.mark();
+            if (grid.assign(*cell, details::mask_lowest_index(mask))
+                && grid.propagate()
+                && search_propagating(grid, call_count)) {
+                return true;
+            }
+            grid.undo(mark);
+        }
+        // Every candidate leads to a contradiction.
+        return false;
+    }
+
     /**
      * Returns index of the block that contains the given cell.
      *
@@ -546,12 +1025,8 @@ class SudokuBoard {
     {
         sudoku_board.clear();
 
-        auto it = std::begin(*sudoku_board.m_board_entries);
-        auto end = std::end(*sudoku_board.m_board_entries);
-
-        // Manually iterate over iterator range since we need access to the raw
-        // iterator to determine the board coordinate.
-        while (it != end) {
+        std::size_t cell{0};
+        while (cell < k_dim * k_dim) {
             // Each Sudoku entry is represented by a single character.
             char entry_symbol;
             if (!(in >> entry_symbol)) {
@@ -559,28 +1034,46 @@ class SudokuBoard {
                 // Stop reading the Sudoku board - all remaining entries will be blank.
                 break;
             }
-
-            // Place the character into a string stream so that we can use
-            // Entry's operator>> overload to convert it into an entry.
-            std::stringstream symbol_stream;
-            symbol_stream << entry_symbol;
-
-            if (Entry entry_candidate;
-                symbol_stream >> entry_candidate
-                    && sudoku_board.m_entry_policy.entry_valid(entry_candidate, sudoku_board.k_dim)
-                ) {
-                // todo decide how to handle invalid sudoku boards. For now we silently omit illegal entries.
-                sudoku_board.set_cell(
-                    sudoku_board.m_board_entries->coordinate_of(it),
-                    entry_candidate
-                );
-            }
-            ++it;
+            // Whitespace has already been skipped by the stream.
+            sudoku_board.read_symbol(cell, entry_symbol);
+            ++cell;
         }
 
         return in;
     }
 
+    /**
+     * Sets the cell with the given row-major index from the given symbol.
+     * Unknown symbols and illegal entries leave the cell unchanged.
+     *
+     * @return False if the symbol is whitespace, which does not represent a cell.
+     */
+    bool read_symbol(std::size_t cell, char symbol)
+    {
+        const auto index = entry_symbols().indices[static_cast<unsigned char>(symbol)];
+        if (index == EntrySymbols::k_skip) {
+            return false;
+        }
+        if (index != EntrySymbols::k_blank) {
+            // todo decide how to handle invalid sudoku boards. For now we silently omit illegal entries.
+            set_cell({cell / k_dim, cell % k_dim}, m_entry_policy.reverse_index(index));
+        }
+        return true;
+    }
+
+    /// Returns the symbol table index of the given entry.
+    std::size_t symbol_index(Entry entry) const
+    {
+        return entry == m_entry_policy.blank_sentinel ? k_dim : m_entry_policy.index_of(entry);
+    }
+
+    /// Returns the lookup tables for this board type, which are built on first use.
+    static const EntrySymbols& entry_symbols()
+    {
+        static const EntrySymbols symbols;
+        return symbols;
+    }
+
     /// Returns the coordinate that follows `coord` when scanning a board left-
     /// to-right, top-to-bottom.
     constexpr static std::optional<Coordinate> step_row(Coordinate coord)
@@ -652,40 +1145,36 @@ namespace details {
  * Aggregate storing information about row, column, and block conflicts in
  * a Sudoku board.
  *
+ * Each row, column, and block is represented by a single bitmask in which
+ * bit i is set when the entry with index i is present. The legal candidates
+ * for a cell are then the bits that are clear in the union of the masks of
+ * its row, column, and block.
+ *
  * @tparam N The number of rows/columns/blocks in the board.
  */
 template<std::size_t N>
 struct BoardConflicts {
-    /**
-     * Matrix used to store whether a conflict exists for each entry value in
-     * each row/column/block. Each row in the matrix represents a single row/
-     * column/block.
-     */
-    using Table = Matrix<bool, N>;
+    static_assert(N <= 64, "conflict masks support at most 64 entry values");
+
+    /// Bitmask with one bit per entry value.
+    using Mask = ConflictMask<N>;
 
     /// Integral type used to store the number of conflicts in a conflict source.
     using Count = unsigned int;
 
-    /// Type used to index the rows of a Table.
-    using Index = typename Table::size_type;
+    /// Type used to index the rows/columns/blocks and entries.
+    using Index = std::size_t;
 
-    /// Aggregate storing the conflict table togethor with the number of conflicts
-    /// contained in each row of the table.
-    struct ConflictSource {
-        /*
-         * Grid of k_dim rows where each row stores whether the entry associated
-         * with a given column has a conflict elsewhere in the row/column/block.
-         */
-        Table table;
-
-        /// Cache of the number of conflicts present in each row of the conflict table.
-        std::array<Count, N> counts;
-    };
+    /// The conflict masks of each row/column/block.
+    using ConflictSource = std::array<Mask, N>;
 
     /// Member pointer to a conflict source. Used to abstract over operations that
     /// may be performed identically on the row, column, or block conflicts.
     using Source = ConflictSource BoardConflicts::*;
 
+    /// Mask with the bits of every entry value set.
+    constexpr static Mask k_all_entries{k_all_entries_mask<N>};
+
     ConflictSource rows;
     ConflictSource cols;
     ConflictSource blocks;
@@ -693,29 +1182,40 @@ struct BoardConflicts {
     /// Cache of number of conflicts associated with each entry index.
     std::array<Count, N> entry_counts;
 
+    /// Returns the mask bit that represents the entry with the given index.
+    constexpr static Mask bit_of(Index entry_index)
+    {
+        return static_cast<Mask>(Mask{1} << entry_index);
+    }
+
     /// Sets the conflict states of the specified row/column/block for the given entry.
     void set_source(const Source source, Index source_index, Index entry_index, bool state)
     {
-        // Whether the given entry has a conflict in the row/column/block indexed by source_index.
-        bool& conflict_flag = (this->*source).table[{source_index, entry_index}];
+        // The entries present in the row/column/block indexed by source_index.
+        Mask& mask = (this->*source)[source_index];
+        const Mask bit = bit_of(entry_index);
 
-        // Update the conflict count for row/column/block.
-        if (conflict_flag != state) {
+        // Update the conflict count for the entry.
+        if (((mask & bit) != 0) != state) {
+            mask ^= bit;
             if (state) {
-                (this->*source).counts[source_index] += 1;
                 entry_counts[entry_index] += 1;
             } else {
-                (this->*source).counts[source_index] -= 1;
                 entry_counts[entry_index] -= 1;
             }
         }
-        conflict_flag = state;
     }
 
     /// Returns the conflict states of the specified row/column/block for the given entry.
     [[nodiscard]] bool check_source(const Source source, Index source_index, Index entry_index) const
     {
-        return (this->*source).table[{source_index, entry_index}];
+        return ((this->*source)[source_index] & bit_of(entry_index)) != 0;
+    }
+
+    /// Returns the mask of entries that conflict with none of the given row, column, and block.
+    [[nodiscard]] Mask candidates(Index row, Index col, Index block) const
+    {
+        return static_cast<Mask>(~(rows[row] | cols[col] | blocks[block]) & k_all_entries);
     }
 
     /**
@@ -728,7 +1228,13 @@ struct BoardConflicts {
      */
     [[nodiscard]] std::optional<std::pair<Index, Count>> promising_index(const Source source) const
     {
-        const auto& count_array = (this->*source).counts;
+        std::array<Count, N> count_array;
+        std::transform(
+            std::cbegin(this->*source),
+            std::cend(this->*source),
+            std::begin(count_array),
+            [](Mask mask) { return details::mask_popcount(mask); }
+        );
 
         const auto pos = details::max_bounded(std::cbegin(count_array), std::cend(count_array), N);
 
@@ -742,9 +1248,158 @@ struct BoardConflicts {
 
 };
 
+/**
+ * The blank cells of a Sudoku board with N rows, grouped into buckets by
+ * their number of candidates.
+ *
+ * Each bucket is a doubly linked list threaded through arrays indexed by
+ * cell, so moving a cell between buckets takes constant time and finding a
+ * cell with the fewest candidates only inspects the N + 1 bucket heads.
+ *
+ * @tparam N The number of rows/columns/blocks in the board.
+ */
+template<std::size_t N>
+class CandidateBuckets {
+    /// Type used to store cell numbers.
+    using Cell = std::uint16_t;
+
+    /// The number of cells on the board.
+    constexpr static std::size_t k_cells{N * N};
+
+    /// Link value marking the end of a bucket.
+    constexpr static Cell k_none{std::numeric_limits<Cell>::max()};
+
+    /// Count value stored for cells that are not in any bucket.
+    constexpr static std::uint8_t k_absent{std::numeric_limits<std::uint8_t>::max()};
+
+    static_assert(k_cells < k_none && N < k_absent);
+
+    /// The first cell of each bucket, indexed by candidate count.
+    std::array<Cell, N + 1> m_heads;
+
+    /// The next and previous cells in each cell's bucket.
+    std::array<Cell, k_cells> m_next;
+    std::array<Cell, k_cells> m_prev;
+
+    /// The bucket containing each cell, or k_absent.
+    std::array<std::uint8_t, k_cells> m_counts;
+
+  public:
+    /// Creates an empty set of buckets.
+    CandidateBuckets()
+    {
+        m_heads.fill(k_none);
+        m_counts.fill(k_absent);
+    }
+
+    /// Places the given cell in the bucket for the given candidate count.
+    void update(std::size_t cell, std::size_t count)
+    {
+        if (m_counts[cell] == count) {
+            return;
+        }
+        remove(cell);
+
+        const auto index = static_cast<Cell>(cell);
+        m_counts[cell] = static_cast<std::uint8_t>(count);
+        m_prev[cell] = k_none;
+        m_next[cell] = m_heads[count];
+        if (m_heads[count] != k_none) {
+            m_prev[m_heads[count]] = index;
+        }
+        m_heads[count] = index;
+    }
+
+    /// Removes the given cell from its bucket, if any.
+    void remove(std::size_t cell)
+    {
+        const auto count = m_counts[cell];
+        if (count == k_absent) {
+            return;
+        }
+        if (m_prev[cell] != k_none) {
+            m_next[m_prev[cell]] = m_next[cell];
+        } else {
+            m_heads[count] = m_next[cell];
+        }
+        if (m_next[cell] != k_none) {
+            m_prev[m_next[cell]] = m_prev[cell];
+        }
+        m_counts[cell] = k_absent;
+    }
+
+    /// Returns a cell with the fewest candidates, or an empty optional if there are no cells.
+    [[nodiscard]] std::optional<std::size_t> minimum() const
+    {
+        for (const auto head : m_heads) {
+            if (head != k_none) {
+                return head;
+            }
+        }
+        return std::nullopt;
+    }
+};
+
 /// Ensure that Conflicts is an aggregate.
 static_assert(std::is_aggregate_v<BoardConflicts<1>>);
 
+/**
+ * Lookup tables between the entries of a Sudoku board with N rows and the
+ * characters used to represent them.
+ *
+ * The tables are derived once from Entry's stream operators, so that the
+ * direct parser and serializer agree with operator>> and operator<<.
+ *
+ * @tparam N The number of rows/columns/blocks in the board.
+ */
+template<typename Entry, typename Policy, std::size_t N>
+struct EntrySymbols {
+    /// Index value for characters that represent a blank cell.
+    constexpr static std::uint8_t k_blank{0xFF};
+
+    /// Index value for whitespace characters, which do not represent a cell.
+    constexpr static std::uint8_t k_skip{0xFE};
+
+    static_assert(N < k_skip, "entry indices must fit below the special index values");
+
+    /// The entry index of each character, or k_blank or k_skip.
+    std::array<std::uint8_t, 256> indices;
+
+    /// The representation of each entry index, followed by that of a blank cell.
+    std::array<std::string, N + 1> symbols;
+
+    /// Whether every representation is exactly one character long.
+    bool single_char{true};
+
+    EntrySymbols()
+    {
+        const Policy policy{};
+
+        for (std::size_t c{0}; c < indices.size(); ++c) {
+            const auto symbol = static_cast<char>(c);
+            if (std::isspace(static_cast<unsigned char>(symbol))) {
+                // Stream extraction skips whitespace.
+                indices[c] = k_skip;
+                continue;
+            }
+
+            std::stringstream symbol_stream;
+            symbol_stream << symbol;
+            Entry entry{};
+            indices[c] = (symbol_stream >> entry) && policy.entry_valid(entry, N)
+                ? static_cast<std::uint8_t>(policy.index_of(entry))
+                : k_blank;
+        }
+
+        for (std::size_t i{0}; i <= N; ++i) {
+            std::ostringstream symbol_stream;
+            symbol_stream << (i < N ? policy.reverse_index(i) : policy.blank_sentinel);
+            symbols[i] = symbol_stream.str();
+            single_char = single_char && symbols[i].size() == 1;
+        }
+    }
+};
+
 } // end namespace details
 
 #endif //EECE_2560_PROJECTS_SUDOKU_BOARD_H
@@ -0,0 +1,102 @@
+/**
+ * Sudoku cell entry type shared by the project 4 executables.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#ifndef EECE_2560_PROJECTS_SUDOKU_ENTRY_H
+#define EECE_2560_PROJECTS_SUDOKU_ENTRY_H
+
+#include <cstddef>          // for std::size_t
+#include <iostream>         // for I/O stream definitions
+#include <type_traits>      // for std::is_aggregate_v
+
+#include "sudoku_board.h"
+
+/**
+ * Simple single-member aggregate class providing custom formatting for sudoku
+ * cell entries.
+ *
+ * Each entry is represented by a single symbol: the digits 1-9 stand for
+ * themselves, and the letters a-z stand for the values 10 and above. Entries
+ * are written in lowercase, but uppercase letters are read as well, so that
+ * hexadecimal boards such as "0A3F" read as they would with std::hex.
+ */
+struct SudokuEntry {
+    /// Type used to represent an entry's value.
+    using Value = unsigned int;
+
+    /// Symbol used to indicate the a sudoku board cell is blank.
+    constexpr static char k_blank_symbol{'.'};
+
+    /// This entry's values.
+    Value value;
+
+    constexpr bool operator==(SudokuEntry rhs) const { return value == rhs.value; }
+
+    constexpr bool operator!=(SudokuEntry rhs) const { return !(rhs == *this); }
+
+    friend std::istream& operator>>(std::istream& in, SudokuEntry& entry)
+    {
+        // Like arithmetic extraction, store zero if no entry can be read.
+        entry.value = 0;
+
+        char symbol;
+        if (!(in >> symbol)) {
+            return in;
+        }
+
+        if (symbol >= '0' && symbol <= '9') {
+            entry.value = static_cast<Value>(symbol - '0');
+        } else if (symbol >= 'a' && symbol <= 'z') {
+            entry.value = static_cast<Value>(symbol - 'a' + 10);
+        } else if (symbol >= 'A' && symbol <= 'Z') {
+            entry.value = static_cast<Value>(symbol - 'A' + 10);
+        } else {
+            // Blank and unknown symbols cannot be converted to an entry.
+            in.setstate(std::ios::failbit);
+        }
+        return in;
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, SudokuEntry entry)
+    {
+        if (entry.value == 0) {
+            out << k_blank_symbol;
+        } else if (entry.value < 10) {
+            out << static_cast<char>('0' + entry.value);
+        } else {
+            out << static_cast<char>('a' - 10 + entry.value);
+        }
+        return out;
+    }
+};
+
+/// Confirm that SudokuEntry is an aggregate.
+static_assert(std::is_aggregate_v<SudokuEntry>);
+
+// SudokuEntryPolicy specialization for SudokuEntry. This must be placed in the
+// global namespace.
+template<>
+struct SudokuEntryPolicy<SudokuEntry> {
+    const SudokuEntry blank_sentinel{0};
+
+    constexpr std::size_t index_of(SudokuEntry entry) const { return entry.value - 1; }
+
+    constexpr bool entry_valid(SudokuEntry entry, std::size_t board_dimension) const
+    {
+        return entry.value > 0 && entry.value <= board_dimension;
+    }
+
+    constexpr SudokuEntry reverse_index(std::size_t index) const
+    {
+        return SudokuEntry{
+            static_cast<SudokuEntry::Value>(index + 1)
+        };
+    }
+};
+
+#endif //EECE_2560_PROJECTS_SUDOKU_ENTRY_H
@@ -0,0 +1,357 @@
+/**
+ * Project 4 Sudoku puzzle generator.
+ *
+ * Generates puzzles with exactly one solution, one per line, in the format read
+ * by the project 4 solvers. Each puzzle starts as a random full grid, made by
+ * filling the blocks on the main diagonal with random permutations (which
+ * cannot conflict with each other) and solving the rest. The solver always
+ * tries the lowest candidate first, so the solved grid is then shuffled with
+ * transformations that preserve validity: a random relabelling of the
+ * entries, random orders of the bands and stacks and of the rows and columns
+ * within them, and a random transposition. Clues are then removed in a random
+ * order, and each removal is undone if the puzzle no longer has a unique
+ * solution. The result is a minimal puzzle: no clue can be removed without
+ * losing uniqueness.
+ *
+ * Difficulty is measured by the number of calls the MRV solver makes to solve
+ * the puzzle. Unlike the propagating solvers, which solve almost every 9x9
+ * puzzle without guessing, its call count varies widely between puzzles. A
+ * puzzle easier than the requested minimum is removed from again in a new
+ * random order, starting from the same solved grid, and the grid is only
+ * discarded after several such orders fail.
+ *
+ * Puzzles are generated in parallel on a thread pool. Each worker owns its own
+ * board and random generator, which it reseeds for every puzzle from the base
+ * seed and the puzzle's index. The output for a given seed therefore does not
+ * depend on the number of threads.
+ *
+ * Usage: 8-schcre-4-generate [count] [box_size] [min_calls] [threads] [seed]
+ *
+ * where box_size is 3 for 9x9 puzzles (default) or 4 for 16x16 puzzles.
+ *
+ * Authors: Brian Schubert  <schubert.b@northeastern.edu>
+ *          Chandler Cree   <cree.d@northeastern.edu>
+ * Date:    2026-10-16
+ *
+ */
+
+#include <algorithm>        // for std::min, std::shuffle, std::swap
+#include <array>            // for std::array
+#include <atomic>           // for std::atomic
+#include <chrono>           // for std::chrono::steady_clock
+#include <cstddef>          // for std::ptrdiff_t
+#include <cstdint>          // for std::uint64_t
+#include <cstdlib>          // for std::strtoull, EXIT_FAILURE
+#include <future>           // for std::future
+#include <iomanip>          // for I/O stream manipulators
+#include <iostream>         // for I/O stream definitions
+#include <memory>           // for std::make_unique
+#include <numeric>          // for std::iota
+#include <random>           // for std::mt19937_64, std::seed_seq, std::random_device
+#include <string>           // for std::string
+#include <thread>           // for std::thread
+#include <vector>           // for std::vector
+
+#include "call_statistics.h"
+#include "eece2560_thread_pool.h"
+#include "sudoku_board.h"
+#include "sudoku_entry.h"
+
+namespace {
+/// Default number of puzzles to generate.
+constexpr std::size_t k_default_count{1000};
+
+/// The number of puzzles generated and written at a time. Bounds the memory
+/// used for arbitrarily large corpora.
+constexpr std::size_t k_batch_size{1u << 14};
+
+/// The maximum number of attempts (clue removal orders) made for each puzzle
+/// before giving up on reaching the requested difficulty.
+constexpr std::size_t k_max_attempts{10'000};
+
+/// The number of clue removal orders tried on each solved grid before a new
+/// grid is generated.
+constexpr std::size_t k_orders_per_grid{16};
+
+/// Scratch buffers reused by a worker for every puzzle it generates.
+struct Scratch {
+    /// One element per cell.
+    std::vector<std::size_t> cells;
+
+    /// One element per entry value.
+    std::vector<SudokuEntry::Value> values;
+
+    /// The source row of each row and the source column of each column of
+    /// the shuffled grid.
+    std::vector<std::size_t> rows;
+    std::vector<std::size_t> cols;
+
+    /// The entries of the solved grid in row-major order.
+    std::vector<SudokuEntry::Value> grid;
+
+    /// The shuffled solved grid that clues are removed from, in the format
+    /// read by the solvers.
+    std::string solution;
+
+    explicit Scratch(std::size_t dim)
+        : cells(dim * dim), values(dim), rows(dim), cols(dim), grid(dim * dim) {}
+};
+
+/// A generated puzzle.
+struct Puzzle {
+    /// The puzzle, in the format read by the solvers. Empty if generation failed.
+    std::string line;
+    std::size_t clues;
+    std::uint64_t call_count;
+    std::size_t attempts;
+};
+
+/**
+ * Fills `order` with a random order of the rows (or columns) of a board with
+ * characteristic size N that keeps every band (or stack) of N lines together.
+ */
+template<std::size_t N>
+void shuffle_lines(std::vector<std::size_t>& order, std::mt19937_64& rng)
+{
+    std::array<std::size_t, N> bands;
+    std::iota(std::begin(bands), std::end(bands), 0);
+    std::shuffle(std::begin(bands), std::end(bands), rng);
+
+    for (std::size_t band{0}; band < N; ++band) {
+        const auto first = std::begin(order) + static_cast<std::ptrdiff_t>(band * N);
+        std::iota(first, first + N, bands[band] * N);
+        std::shuffle(first, first + N, rng);
+    }
+}
+
+/**
+ * Replaces the solved grid on the given board with a random grid from the same
+ * family of equivalent grids.
+ *
+ * Relabelling entries, reordering bands, stacks, and the lines within them,
+ * and transposing all map valid grids to valid grids.
+ */
+template<std::size_t N>
+void shuffle_solution(SudokuBoard<N, SudokuEntry>& board, std::mt19937_64& rng, Scratch& scratch)
+{
+    constexpr auto k_dim = SudokuBoard<N, SudokuEntry>::dim();
+
+    for (std::size_t cell{0}; cell < k_dim * k_dim; ++cell) {
+        scratch.grid[cell] = board.get_cell({cell / k_dim, cell % k_dim}).value;
+    }
+
+    // The entry with value v is relabelled to values[v - 1].
+    std::shuffle(std::begin(scratch.values), std::end(scratch.values), rng);
+    shuffle_lines<N>(scratch.rows, rng);
+    shuffle_lines<N>(scratch.cols, rng);
+    const bool transpose = std::uniform_int_distribution<int>(0, 1)(rng) == 1;
+
+    board.clear();
+    for (std::size_t row{0}; row < k_dim; ++row) {
+        for (std::size_t col{0}; col < k_dim; ++col) {
+            auto source_row = scratch.rows[row];
+            auto source_col = scratch.cols[col];
+            if (transpose) {
+                std::swap(source_row, source_col);
+            }
+            const auto value = scratch.grid[source_row * k_dim + source_col];
+            board.set_cell({row, col}, SudokuEntry{scratch.values[value - 1]});
+        }
+    }
+}
+
+/**
+ * Generates a random minimal puzzle with a unique solution that requires at
+ * least `min_calls` calls of the MRV solver to solve.
+ *
+ * @param board Scratch board used to build the puzzle.
+ * @param rng Random generator.
+ * @param scratch Scratch buffers for a board with the same dimension.
+ */
+template<std::size_t N>
+Puzzle generate_puzzle(
+    SudokuBoard<N, SudokuEntry>& board,
+    std::mt19937_64& rng,
+    Scratch& scratch,
+    std::uint64_t min_calls)
+{
+    constexpr auto k_dim = SudokuBoard<N, SudokuEntry>::dim();
+
+    // Restore the scratch buffers so that the puzzle depends only on the
+    // state of the random generator.
+    auto& cells = scratch.cells;
+    auto& values = scratch.values;
+    std::iota(std::begin(cells), std::end(cells), 0);
+    std::iota(std::begin(values), std::end(values), 1);
+
+    // The number of removal orders left to try on the current solved grid.
+    std::size_t orders_left{0};
+
+    for (std::size_t attempt{1}; attempt <= k_max_attempts; ++attempt) {
+        if (orders_left == 0) {
+            // Fill the diagonal blocks, which share no row, column, or block.
+            board.clear();
+            for (std::size_t block{0}; block < N; ++block) {
+                std::shuffle(std::begin(values), std::end(values), rng);
+                for (std::size_t i{0}; i < k_dim; ++i) {
+                    board.set_cell({block * N + i / N, block * N + i % N}, SudokuEntry{values[i]});
+                }
+            }
+            if (!board.solve_iterative().first) {
+                continue;
+            }
+            shuffle_solution(board, rng, scratch);
+            scratch.solution = board.line_string();
+            orders_left = k_orders_per_grid;
+        } else {
+            board.read_line(scratch.solution);
+        }
+        --orders_left;
+
+        // Remove every clue that is not needed for a unique solution.
+        std::size_t clues{k_dim * k_dim};
+        std::shuffle(std::begin(cells), std::end(cells), rng);
+        for (const auto cell : cells) {
+            const std::pair<std::size_t, std::size_t> coord{cell / k_dim, cell % k_dim};
+            const auto entry = board.get_cell(coord);
+            board.clear_cell(coord);
+            if (board.has_unique_solution()) {
+                --clues;
+            } else {
+                board.set_cell(coord, entry);
+            }
+        }
+
+        auto line = board.line_string();
+        const std::uint64_t call_count = board.solve_mrv().second;
+        if (call_count >= min_calls) {
+            return Puzzle{std::move(line), clues, call_count, attempt};
+        }
+    }
+    return Puzzle{std::string{}, 0, 0, k_max_attempts};
+}
+
+/**
+ * Generates and writes `count` puzzles, then reports statistics.
+ */
+template<std::size_t N>
+int generate_puzzles(
+    std::size_t count,
+    std::uint64_t min_calls,
+    std::size_t thread_count,
+    std::uint64_t seed)
+{
+    using Board = SudokuBoard<N, SudokuEntry>;
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    eece2560::ThreadPool pool(thread_count);
+    std::vector<Puzzle> puzzles(std::min(count, k_batch_size));
+    std::vector<std::uint64_t> puzzle_call_counts;
+    puzzle_call_counts.reserve(count);
+    std::size_t total_clues{0};
+    std::size_t total_attempts{0};
+    std::size_t failures{0};
+
+    for (std::size_t batch_start{0}; batch_start < count; batch_start += k_batch_size) {
+        const auto batch_count = std::min(k_batch_size, count - batch_start);
+        std::atomic<std::size_t> next_puzzle{0};
+
+        std::vector<std::future<void>> workers;
+        workers.reserve(pool.size());
+        for (std::size_t i{0}; i < pool.size(); ++i) {
+            workers.push_back(pool.submit([&]() {
+                auto board = std::make_unique<Board>();
+                std::mt19937_64 rng;
+                Scratch scratch(Board::dim());
+
+                std::size_t index;
+                while ((index = next_puzzle.fetch_add(1, std::memory_order_relaxed)) < batch_count) {
+                    const auto puzzle_number = batch_start + index;
+                    std::seed_seq puzzle_seed{
+                        static_cast<std::seed_seq::result_type>(seed),
+                        static_cast<std::seed_seq::result_type>(seed >> 32),
+                        static_cast<std::seed_seq::result_type>(puzzle_number),
+                        static_cast<std::seed_seq::result_type>(puzzle_number >> 32)
+                    };
+                    rng.seed(puzzle_seed);
+                    puzzles[index] = generate_puzzle(*board, rng, scratch, min_calls);
+                }
+            }));
+        }
+
+        // Wait for every worker before rethrowing any exception, since the
+        // workers refer to this function's locals.
+        for (auto& worker : workers) {
+            worker.wait();
+        }
+        for (auto& worker : workers) {
+            worker.get();
+        }
+
+        for (std::size_t i{0}; i < batch_count; ++i) {
+            total_attempts += puzzles[i].attempts;
+            if (puzzles[i].line.empty()) {
+                ++failures;
+                continue;
+            }
+            std::cout << puzzles[i].line << '\n';
+            total_clues += puzzles[i].clues;
+            puzzle_call_counts.push_back(puzzles[i].call_count);
+        }
+    }
+    std::cout.flush();
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    const auto puzzle_count = puzzle_call_counts.size();
+    if (failures > 0) {
+        std::cerr << "Gave up on " << failures << " puzzles after " << k_max_attempts
+                  << " attempts each without reaching " << min_calls << " calls.\n";
+    }
+    if (puzzle_count == 0) {
+        return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    const auto[median, average] = call_statistics(puzzle_call_counts);
+
+    std::cerr << std::fixed << std::setprecision(0)
+              << "Puzzles generated: " << std::setw(8) << puzzle_count << '\n'
+              << "Attempts made:     " << std::setw(8) << total_attempts << '\n'
+              << "Threads:           " << std::setw(8) << pool.size() << '\n'
+              << "Elapsed seconds:   " << std::setw(12) << std::setprecision(3) << elapsed.count() << '\n'
+              << "Puzzles/s:         " << std::setw(11) << std::setprecision(2)
+              << static_cast<double>(puzzle_count) / elapsed.count() << '\n'
+              << "Avg. clues:        " << std::setw(10) << std::setprecision(1)
+              << static_cast<double>(total_clues) / static_cast<double>(puzzle_count) << '\n'
+              << "Median calls made: " << std::setw(8) << median << '\n'
+              << "Avg. calls made:   " << std::setw(8) << std::setprecision(0) << average << '\n';
+
+    return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+} // end namespace
+
+int main(int argc, char* argv[])
+{
+    const auto arg_or = [&](int index, std::uint64_t fallback) {
+        return argc > index ? static_cast<std::uint64_t>(std::strtoull(argv[index], nullptr, 0)) : fallback;
+    };
+
+    const auto count = static_cast<std::size_t>(arg_or(1, k_default_count));
+    const auto box_size = arg_or(2, 3);
+    const auto min_calls = arg_or(3, 1);
+    const auto thread_count = static_cast<std::size_t>(arg_or(4, std::thread::hardware_concurrency()));
+    const auto seed = arg_or(5, std::random_device{}());
+
+    std::ios::sync_with_stdio(false);
+
+    switch (box_size) {
+        case 3:
+            return generate_puzzles<3>(count, min_calls, thread_count, seed);
+        case 4:
+            return generate_puzzles<4>(count, min_calls, thread_count, seed);
+        default:
+            std::cerr << "Unsupported box size " << box_size << "; expected 3 or 4\n";
+            return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,153 @@
+/**
+ * Test executable for the EECE 2560 common utilities.
+ *
+ * Exercises the lock-free ConcurrentQueue from a single thread and under
+ * concurrent producers and consumers.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "eece2560_concurrent_queue.h"
+
+// Using anonymous namespace to give symbols internal linkage.
+namespace {
+
+/// The number of threads pushing to the queue in the stress test.
+constexpr int k_producer_count{4};
+
+/// The number of threads popping from the queue in the stress test.
+constexpr int k_consumer_count{4};
+
+/// The number of values pushed by each producer in the stress test.
+constexpr int k_values_per_producer{100'000};
+
+/// Number of live Tracked objects.
+std::atomic<int> g_live_tracked{0};
+
+/// Element type that counts how many of its instances are alive.
+struct Tracked {
+    int m_value;
+
+    explicit Tracked(int value) : m_value(value) { ++g_live_tracked; }
+
+    Tracked(const Tracked& other) : m_value(other.m_value) { ++g_live_tracked; }
+
+    Tracked(Tracked&& other) noexcept: m_value(other.m_value) { ++g_live_tracked; }
+
+    Tracked& operator=(const Tracked&) = default;
+
+    Tracked& operator=(Tracked&&) = default;
+
+    ~Tracked() { --g_live_tracked; }
+};
+
+/// Reports the outcome of a single test case and returns whether it passed.
+bool report(const char* name, bool passed)
+{
+    std::cout << "Case " << name << (passed ? " OK\n" : " FAILED\n");
+    return passed;
+}
+
+/// Checks that try_pop on an empty queue returns no element.
+bool test_empty_pop()
+{
+    eece2560::ConcurrentQueue<int> queue;
+    if (queue.try_pop()) {
+        return false;
+    }
+    queue.push(1);
+    const auto value = queue.try_pop();
+    return value == 1 && !queue.try_pop();
+}
+
+/// Checks that a single thread observes FIFO order.
+bool test_fifo_order()
+{
+    eece2560::ConcurrentQueue<int> queue;
+    for (int i{0}; i < 1000; ++i) {
+        queue.push(i);
+    }
+    for (int i{0}; i < 1000; ++i) {
+        if (queue.try_pop() != i) {
+            return false;
+        }
+    }
+    return !queue.try_pop();
+}
+
+/// Checks that destroying a non-empty queue destroys its remaining elements.
+bool test_destroy_nonempty()
+{
+    {
+        eece2560::ConcurrentQueue<Tracked> queue;
+        for (int i{0}; i < 1000; ++i) {
+            queue.push(Tracked{i});
+        }
+        // Pop some elements so that the queue also holds retired nodes.
+        for (int i{0}; i < 600; ++i) {
+            queue.try_pop();
+        }
+    }
+    return g_live_tracked.load() == 0;
+}
+
+/**
+ * Checks that every value pushed by several concurrent producers is popped
+ * exactly once by several concurrent consumers.
+ */
+bool test_mpmc_stress()
+{
+    constexpr int total{k_producer_count * k_values_per_producer};
+
+    eece2560::ConcurrentQueue<int> queue;
+    std::vector<std::atomic<int>> pop_counts(static_cast<std::size_t>(total));
+    std::atomic<int> popped{0};
+
+    std::vector<std::thread> threads;
+    for (int p{0}; p < k_producer_count; ++p) {
+        threads.emplace_back([&queue, p]() {
+            for (int i{0}; i < k_values_per_producer; ++i) {
+                queue.push(p * k_values_per_producer + i);
+            }
+        });
+    }
+    for (int c{0}; c < k_consumer_count; ++c) {
+        threads.emplace_back([&]() {
+            while (popped.load() < total) {
+                if (const auto value = queue.try_pop()) {
+                    ++pop_counts[static_cast<std::size_t>(*value)];
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& count : pop_counts) {
+        if (count.load() != 1) {
+            return false;
+        }
+    }
+    return !queue.try_pop();
+}
+
+} // end namespace
+
+int main()
+{
+    bool passed{true};
+    passed &= report("empty try_pop", test_empty_pop());
+    passed &= report("FIFO order", test_fifo_order());
+    passed &= report("destroy non-empty queue", test_destroy_nonempty());
+    passed &= report("MPMC stress", test_mpmc_stress());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,356 @@
+/**
+ * Common lock-free queue. Project 4's parallel grid search uses one per worker
+ * to hold the branches that other workers may steal.
+ *
+ * For ease of user, this utility is implemented as a header-only library.
+ *
+ * References
+ * ==========
+ *  [1] https://www.cs.rochester.edu/u/scott/papers/1996_PODC_queues.pdf
+ *  [2] https://doi.org/10.1109/TPDS.2004.8 (Michael, "Hazard Pointers")
+ *  [3] https://en.cppreference.com/w/cpp/atomic/atomic
+ *  [4] https://en.cppreference.com/w/cpp/atomic/memory_order
+ *  [5] https://isocpp.github.io/CppCoreGuidelines/CppCoreGuidelines
+ */
+
+#ifndef EECE_2560_PROJECTS_EECE2560_CONCURRENT_QUEUE_H
+#define EECE_2560_PROJECTS_EECE2560_CONCURRENT_QUEUE_H
+
+#include <algorithm>        // for std::find
+#include <array>            // for std::array
+#include <atomic>           // for std::atomic
+#include <cstddef>          // for std::size_t
+#include <functional>       // for std::hash
+#include <optional>         // for std::optional
+#include <thread>           // for std::this_thread
+#include <utility>          // for std::move
+#include <vector>           // for std::vector
+
+namespace eece2560 {
+
+/**
+ * An unbounded, lock-free, multi-producer/multi-consumer FIFO queue.
+ *
+ * This class implements the Michael-Scott queue [1] on top of the same node
+ * layout used by the project 2 LinkedList: a data-less BaseNode that only
+ * holds the link to its successor, and a Node that additionally stores a value.
+ * Like LinkedList, the queue embeds a BaseNode as its initial sentinel so that
+ * the head of the queue can be treated as just another node.
+ *
+ * Removed nodes are reclaimed with hazard pointers [2]. Each push/pop claims
+ * one of a fixed number of per-queue hazard slots for the duration of the
+ * call, so no thread registration is required. If more threads than slots
+ * are operating on the queue at the same instant, the excess threads spin
+ * until a slot frees up.
+ *
+ * Unlike LinkedList, this class does not provide iterators or a size, since
+ * neither could be meaningful while other threads modify the queue.
+ *
+ * @tparam T The data type of elements stored in the queue.
+ */
+template<typename T>
+class ConcurrentQueue {
+
+    /// Helper class representing a queue link with no data.
+    struct BaseNode {
+        /// Non-owning pointer to the next node. Ownership belongs to the queue.
+        std::atomic<BaseNode*> m_next_ptr{nullptr};
+    };
+
+    /// Helper class representing an element in the queue.
+    struct Node : public BaseNode {
+        /// The value contained in this node.
+        T m_value;
+
+        explicit Node(T value) : m_value(std::move(value)) {}
+    };
+
+    /// The number of hazard slots available to concurrently operating threads.
+    constexpr static std::size_t k_hazard_slots{64};
+
+    /// The number of retired nodes a slot may hold before it scans for nodes
+    /// that can be deleted.
+    constexpr static std::size_t k_retire_threshold{2 * 2 * k_hazard_slots};
+
+    /**
+     * Hazard pointer record claimed by a thread for the duration of a single
+     * queue operation.
+     *
+     * The retired node list is only ever accessed by the thread holding the
+     * slot, so it needs no synchronization of its own.
+     */
+    struct HazardSlot {
+        /// Whether a thread currently holds this slot.
+        std::atomic<bool> m_claimed{false};
+
+        /// Nodes that the holder of this slot is currently reading.
+        std::array<std::atomic<BaseNode*>, 2> m_hazards{};
+
+        /// Nodes unlinked by holders of this slot that are awaiting deletion.
+        std::vector<BaseNode*> m_retired;
+    };
+
+    /**
+     * Initial sentinel node, analogous to LinkedList's m_head.
+     *
+     * This node is never deleted by the queue.
+     */
+    BaseNode m_sentinel{};
+
+    /// The current (dummy) head of the queue. The head node holds no live value.
+    std::atomic<BaseNode*> m_head{&m_sentinel};
+
+    /// The last node of the queue, or a node shortly before it.
+    std::atomic<BaseNode*> m_tail{&m_sentinel};
+
+    /// Hazard pointer records for the threads operating on this queue.
+    std::array<HazardSlot, k_hazard_slots> m_slots{};
+
+  public:
+    // Type aliases for containers. We only provide those that are meaningful
+    // for a concurrent container.
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+
+    /*
+     * Default constructor.
+     *
+     * All members are already given in-class member initializers, so we can
+     * just use the compiler generated default constructor [C.45,C.80 in 5].
+     */
+    ConcurrentQueue() = default;
+
+    /*
+     * Nodes are linked by address and hazard pointers refer to this queue's
+     * slots, so the queue can be neither copied nor moved [C.21,C.81 in 5].
+     */
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    /**
+     * Destroys all remaining elements in the queue.
+     *
+     * The caller must ensure that no other threads are still operating on
+     * this queue.
+     */
+    ~ConcurrentQueue()
+    {
+        for (auto& slot : m_slots) {
+            for (BaseNode* node : slot.m_retired) {
+                delete_node(node);
+            }
+        }
+
+        BaseNode* node = m_head.load();
+        while (node) {
+            BaseNode* next = node->m_next_ptr.load();
+            delete_node(node);
+            node = next;
+        }
+    }
+
+    /**
+     * Inserts the given element at the back of this queue.
+     *
+     * This function is lock-free and may be called concurrently from any
+     * number of threads.
+     *
+     * @param value Element to be inserted.
+     */
+    void push(T value)
+    {
+        BaseNode* const new_node = new Node(std::move(value));
+        SlotGuard guard(*this);
+
+        while (true) {
+            BaseNode* tail = guard.protect(0, m_tail);
+            BaseNode* next = tail->m_next_ptr.load();
+
+            if (tail != m_tail.load()) {
+                // The tail moved while we were reading it.
+                continue;
+            }
+
+            if (next) {
+                // The tail is lagging behind. Help the other producer advance it.
+                m_tail.compare_exchange_weak(tail, next);
+                continue;
+            }
+
+            if (tail->m_next_ptr.compare_exchange_weak(next, new_node)) {
+                // The node is linked. Try to swing the tail to it; if this
+                // fails, another thread has already done so on our behalf.
+                m_tail.compare_exchange_strong(tail, new_node);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Removes the element at the front of this queue, if an element exists.
+     *
+     * This function is lock-free and may be called concurrently from any
+     * number of threads.
+     *
+     * @return Front element, or std::nullopt if the queue was empty.
+     */
+    std::optional<T> try_pop()
+    {
+        SlotGuard guard(*this);
+
+        while (true) {
+            BaseNode* head = guard.protect(0, m_head);
+            BaseNode* tail = m_tail.load();
+            BaseNode* next = guard.protect(1, head->m_next_ptr);
+
+            if (head != m_head.load()) {
+                // The head moved while we were reading it, so `next` may
+                // already have been retired.
+                continue;
+            }
+
+            if (!next) {
+                return std::nullopt;
+            }
+
+            if (head == tail) {
+                // The tail is lagging behind. Help advance it before removing
+                // the head so that the tail never points to a retired node.
+                m_tail.compare_exchange_weak(tail, next);
+                continue;
+            }
+
+            if (m_head.compare_exchange_weak(head, next)) {
+                // `next` is now the dummy head. Only this thread can read its
+                // value, and our hazard pointer keeps it alive.
+                std::optional<T> result{std::move(static_cast<Node*>(next)->m_value)};
+                guard.retire(head);
+                return result;
+            }
+        }
+    }
+
+  private:
+
+    /**
+     * RAII helper that claims a hazard slot for the duration of a single
+     * queue operation.
+     */
+    class SlotGuard {
+        /// The queue whose slot is held.
+        ConcurrentQueue& m_queue;
+
+        /// The held slot.
+        HazardSlot* m_slot;
+
+      public:
+        explicit SlotGuard(ConcurrentQueue& queue) : m_queue(queue), m_slot(queue.claim_slot()) {}
+
+        SlotGuard(const SlotGuard&) = delete;
+
+        SlotGuard& operator=(const SlotGuard&) = delete;
+
+        ~SlotGuard()
+        {
+            for (auto& hazard : m_slot->m_hazards) {
+                hazard.store(nullptr);
+            }
+            m_slot->m_claimed.store(false, std::memory_order_release);
+        }
+
+        /**
+         * Publishes a hazard pointer for the node currently referenced by
+         * `source`, and returns that node.
+         *
+         * The hazard is re-validated against `source` until the two agree,
+         * which guarantees that the node had not been retired before the
+         * hazard became visible to other threads [2]. Sequentially consistent
+         * ordering is used so that the store of the hazard cannot be reordered
+         * after the validating load [4].
+         */
+        BaseNode* protect(std::size_t index, const std::atomic<BaseNode*>& source)
+        {
+            BaseNode* node = source.load();
+            while (true) {
+                m_slot->m_hazards[index].store(node);
+                BaseNode* current = source.load();
+                if (current == node) {
+                    return node;
+                }
+                node = current;
+            }
+        }
+
+        /// Schedules the given unlinked node for deletion.
+        void retire(BaseNode* node)
+        {
+            m_slot->m_retired.push_back(node);
+            if (m_slot->m_retired.size() >= k_retire_threshold) {
+                m_queue.scan(m_slot->m_retired);
+            }
+        }
+    };
+
+    /// Claims a free hazard slot, spinning if all slots are in use.
+    HazardSlot* claim_slot()
+    {
+        // Start the search at a per-thread offset to reduce contention on the
+        // first slots.
+        const std::size_t start = std::hash<std::thread::id>{}(std::this_thread::get_id()) % k_hazard_slots;
+        while (true) {
+            for (std::size_t i{0}; i < k_hazard_slots; ++i) {
+                HazardSlot& slot = m_slots[(start + i) % k_hazard_slots];
+                bool expected{false};
+                if (!slot.m_claimed.load(std::memory_order_relaxed)
+                    && slot.m_claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    return &slot;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * Deletes every node in `retired` that is not protected by a hazard
+     * pointer. Protected nodes remain in the list.
+     */
+    void scan(std::vector<BaseNode*>& retired)
+    {
+        // Snapshot the currently published hazards.
+        std::vector<BaseNode*> hazards;
+        hazards.reserve(2 * k_hazard_slots);
+        for (const auto& slot : m_slots) {
+            for (const auto& hazard : slot.m_hazards) {
+                if (BaseNode* node = hazard.load()) {
+                    hazards.push_back(node);
+                }
+            }
+        }
+
+        auto keep_end = std::begin(retired);
+        for (BaseNode* node : retired) {
+            if (std::find(std::begin(hazards), std::end(hazards), node) != std::end(hazards)) {
+                *keep_end = node;
+                ++keep_end;
+            } else {
+                delete_node(node);
+            }
+        }
+        retired.erase(keep_end, std::end(retired));
+    }
+
+    /// Deletes the given node unless it is this queue's embedded sentinel.
+    void delete_node(BaseNode* node)
+    {
+        if (node != &m_sentinel) {
+            // Every node other than the sentinel was allocated as a Node.
+            delete static_cast<Node*>(node);
+        }
+    }
+}; // end class ConcurrentQueue
+
+} // end namespace eece2560
+
+#endif //EECE_2560_PROJECTS_EECE2560_CONCURRENT_QUEUE_H
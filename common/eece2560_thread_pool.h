@@ -0,0 +1,145 @@
+/**
+ * Common fixed-size thread pool used by the multi-threaded tools in project 3
+ * and beyond.
+ *
+ * For ease of user, this utility is implemented as a header-only library.
+ *
+ * References
+ * ==========
+ *  [1] https://en.cppreference.com/w/cpp/thread/packaged_task
+ *  [2] https://en.cppreference.com/w/cpp/thread/condition_variable
+ *  [3] https://isocpp.github.io/CppCoreGuidelines/CppCoreGuidelines
+ */
+
+#ifndef EECE_2560_PROJECTS_EECE2560_THREAD_POOL_H
+#define EECE_2560_PROJECTS_EECE2560_THREAD_POOL_H
+
+#include <algorithm>            // for std::max
+#include <condition_variable>   // for std::condition_variable
+#include <cstddef>              // for std::size_t
+#include <deque>                // for std::deque
+#include <functional>           // for std::function
+#include <future>               // for std::future, std::packaged_task
+#include <memory>               // for std::make_shared
+#include <mutex>                // for std::mutex, std::unique_lock
+#include <thread>               // for std::thread
+#include <type_traits>          // for std::invoke_result_t
+#include <utility>              // for std::move
+#include <vector>               // for std::vector
+
+namespace eece2560 {
+
+/**
+ * A fixed set of worker threads that execute submitted tasks.
+ *
+ * Tasks are handed to the workers through a deque guarded by a mutex. Idle
+ * workers sleep on a condition variable until tasks arrive [2]. The mutex is
+ * only held while a task is pushed or popped, never while it runs, so the
+ * pool is intended for tasks that are coarse compared to a lock round trip.
+ *
+ * Tasks are started in the order they were submitted, but may complete in any
+ * order. Callers that need ordered results should keep the futures returned
+ * by submit() in order and collect them sequentially.
+ */
+class ThreadPool {
+    /// Tasks waiting to be picked up by a worker.
+    std::deque<std::function<void()>> m_tasks;
+
+    /// Protects m_tasks and m_stopping.
+    std::mutex m_mutex;
+
+    /// Signalled when tasks are submitted or the pool is stopping.
+    std::condition_variable m_wake;
+
+    /// Set when the pool is being destroyed.
+    bool m_stopping{false};
+
+    /// The worker threads.
+    std::vector<std::thread> m_workers;
+
+  public:
+    /// Creates a pool with the given number of worker threads, which defaults
+    /// to the number of hardware threads.
+    explicit ThreadPool(std::size_t thread_count = std::thread::hardware_concurrency())
+    {
+        // hardware_concurrency() may return 0 if the value is not computable.
+        thread_count = std::max<std::size_t>(thread_count, 1);
+        m_workers.reserve(thread_count);
+        for (std::size_t i{0}; i < thread_count; ++i) {
+            m_workers.emplace_back([this]() { run_worker(); });
+        }
+    }
+
+    /*
+     * Workers refer to the pool by address, so the pool can be neither copied
+     * nor moved [C.21,C.81 in 3].
+     */
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Finishes every submitted task, then stops and joins the workers.
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    /// Returns the number of worker threads in this pool.
+    [[nodiscard]] std::size_t size() const noexcept { return m_workers.size(); }
+
+    /**
+     * Schedules the given callable to be run by a worker.
+     *
+     * @return Future that receives the result of the callable, or the
+     *         exception it threw [1].
+     */
+    template<typename F>
+    std::future<std::invoke_result_t<F>> submit(F task)
+    {
+        using Result = std::invoke_result_t<F>;
+        // std::function requires a copyable callable, so the packaged task
+        // is shared rather than moved into the queue.
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+        auto future = packaged->get_future();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace_back([packaged]() { (*packaged)(); });
+        }
+        m_wake.notify_one();
+
+        return future;
+    }
+
+  private:
+    /// Worker thread body. Runs tasks until the pool is stopping and no
+    /// queued tasks remain.
+    void run_worker()
+    {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [this]() { return !m_tasks.empty() || m_stopping; });
+                if (m_tasks.empty()) {
+                    // Only reachable when stopping.
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+} // end namespace eece2560
+
+#endif //EECE_2560_PROJECTS_EECE2560_THREAD_POOL_H